@@ -31,7 +31,7 @@ ring_buf_t *rb_alloc_init(size_t num_cells, size_t max_alloc_size)
         return NULL;  // Capacity must be power of 2
     }
 
-    total_memory = num_cells * sizeof(cell_t) + sizeof(ring_buf_t);
+    total_memory = rb_mem_size(num_cells);
 
     if (total_memory > max_alloc_size) {
         return NULL;  // Prevent excessive memory usage
@@ -43,8 +43,7 @@ ring_buf_t *rb_alloc_init(size_t num_cells, size_t max_alloc_size)
         return NULL;
     }
 
-    /* Clean memory, and also push Kernel to connect physica memory to virtual */
-    memset(d, 1, total_memory);
+    /* Clean memory, and also push Kernel to connect physical memory to virtual; one pass is enough for both */
     memset(d, 0, total_memory);
 
     d->capacity = num_cells;
@@ -58,6 +57,17 @@ ring_buf_t *rb_alloc_init(size_t num_cells, size_t max_alloc_size)
     return d;
 }
 
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Calculate the memory size of a Ring Buffer: the control structure and the cells
+ * @param size_t num_cells     How many records should be in the Ring Buffer
+ * @return size_t Size in bytes
+ */
+size_t rb_mem_size(size_t num_cells)
+{
+    return num_cells * sizeof(cell_t) + sizeof(ring_buf_t);
+}
+
 /**
  * @author Sebastian Mountaniol (04/03/2025)
  * @brief release the Ring Buffer structure
@@ -65,6 +75,11 @@ ring_buf_t *rb_alloc_init(size_t num_cells, size_t max_alloc_size)
  */
 void rb_destroy(ring_buf_t *d)
 {
+    if (d && (d->flags & RB_ALLOC_MMAP)) {
+        munmap(d, rb_mem_size(d->capacity));
+        return;
+    }
+
     free(d);
 }
 
@@ -130,6 +145,172 @@ int rb_pull_ptr(ring_buf_t *d, void **data, size_t *size)
     return RB_OK;
 }
 
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Prefetch the first RB_PREFETCH_MAX_BYTES of a payload
+ * @param const cell_t* cell  Cell holding the payload pointer
+ */
+static inline void rb_prefetch_payload(const cell_t *cell)
+{
+    const char *p = cell->data;
+    size_t len = (size_t)cell->size < RB_PREFETCH_MAX_BYTES ? (size_t)cell->size : RB_PREFETCH_MAX_BYTES;
+
+    for (size_t off = 0; off < len; off += 64) {
+        __builtin_prefetch(p + off, 0, 3);
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer from the Ring Buffer, and prefetch the payloads of the next records
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param void** data  Double pointer; must point to NULL, the pointer to a buffer will be copied into
+ * @param size_t* size  Must point to 0; size of returned buffer
+ * @param unsigned int depth Prefetch distance in records; 0 means adaptive
+ * @return int RB_OK on success, RB_PARAM_ERROR if one of input pointers is invalid; RB_EMPTY if the Ring
+ *         Buffer is empty
+ */
+int rb_pull_ptr_prefetch(ring_buf_t *d, void **data, size_t *size, unsigned int depth)
+{
+    if (!d || !data || *data || !size || *size) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&d->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&d->tail, memory_order_acquire);
+
+    if (head == tail) return RB_EMPTY; // Buffer is empty
+
+    uint64_t mask = d->capacity - 1;
+    uint64_t ahead = tail - head - 1;
+
+    if (0 == depth || depth > RB_PREFETCH_MAX_DEPTH) depth = RB_PREFETCH_MAX_DEPTH;
+    if (ahead > depth) ahead = depth;
+
+    /* One prefetch per pull: the record which just entered the window, the farthest readable one when the
+     * occupancy is lower than the depth */
+    if (ahead > 0) rb_prefetch_payload(&d->cells[(head + ahead) & mask]);
+
+    size_t index = head & mask;
+
+    *data = d->cells[index].data;
+    *size = d->cells[index].size;
+
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&d->head, head + 1, memory_order_release);
+
+    return RB_OK;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull up to max buffers at once, prefetching all their payloads
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param void** data  Array of max pointers, the buffer pointers are copied into
+ * @param size_t* sizes Array of max sizes, the buffer sizes are copied into
+ * @param size_t max   Size of the arrays
+ * @param size_t* pulled Output: how many buffers were pulled
+ * @return int RB_OK if at least one buffer is pulled, RB_EMPTY if the Ring Buffer is empty, RB_PARAM_ERROR if
+ *         one of input pointers is invalid
+ */
+int rb_pull_ptr_batch(ring_buf_t *d, void **data, size_t *sizes, size_t max, size_t *pulled)
+{
+    if (!d || !data || !sizes || !pulled) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&d->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&d->tail, memory_order_acquire);
+    uint64_t mask = d->capacity - 1;
+    size_t count = tail - head < max ? tail - head : max;
+
+    *pulled = count;
+    if (0 == count) return RB_EMPTY; // Buffer is empty
+
+    for (size_t i = 0; i < count; i++) {
+        const cell_t *cell = &d->cells[(head + i) & mask];
+
+        rb_prefetch_payload(cell);
+        data[i] = cell->data;
+        sizes[i] = cell->size;
+    }
+
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&d->head, head + count, memory_order_release);
+
+    return RB_OK;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the readable cells which are contiguous in memory, without removing them (consumer side)
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param cell_t** cells Output: the first readable cell
+ * @return size_t Number of readable cells from *cells up to the end of the array; 0 if the Ring Buffer is empty
+ */
+size_t rb_peek_span(ring_buf_t *d, cell_t **cells)
+{
+    if (!d || !cells) return 0;
+
+    uint64_t head = atomic_load_explicit(&d->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&d->tail, memory_order_acquire);
+    size_t index = head & (d->capacity - 1);
+    size_t count = tail - head;
+
+    if (count > d->capacity - index) count = d->capacity - index; // Stop at the end of the array
+
+    *cells = &d->cells[index];
+    return count;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Remove n records returned by rb_peek_span(), publishing head once (consumer side)
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param size_t n     How many records to remove
+ * @return int RB_OK on success, RB_PARAM_ERROR if the Ring Buffer is NULL or n is larger than the occupancy
+ */
+int rb_release_span(ring_buf_t *d, size_t n)
+{
+    if (!d) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&d->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&d->tail, memory_order_acquire);
+
+    if (n > tail - head) return RB_PARAM_ERROR;
+
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&d->head, head + n, memory_order_release);
+
+    return RB_OK;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Copy up to n cells into the Ring Buffer, publishing tail once (producer side)
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param const cell_t* cells Cells to copy, pointers or integers
+ * @param size_t n     Number of cells
+ * @return size_t Number of copied cells, limited by the free room; 0 if the Ring Buffer is full or on invalid input
+ */
+size_t rb_push_cells(ring_buf_t *d, const cell_t *cells, size_t n)
+{
+    if (!d || !cells) return 0;
+
+    uint64_t tail = atomic_load_explicit(&d->tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&d->head, memory_order_acquire);
+    size_t room = d->capacity - 1 - (tail - head); // One cell always stays empty
+
+    if (n > room) n = room;
+
+    for (size_t i = 0; i < n; i++) {
+        d->cells[(tail + i) & (d->capacity - 1)] = cells[i];
+    }
+
+    if (n > 0) {
+        atomic_thread_fence(memory_order_release);
+        atomic_store_explicit(&d->tail, tail + n, memory_order_release);
+    }
+
+    return n;
+}
+
 /**
  * @author Sebastian Mountaniol (04/03/2025)
  * @brief Push an integer value to Ring Buffer
@@ -20,6 +20,7 @@
  * @brief This enum define status values the Ring Buffer function return
  */
 enum {
+    RB_SPILLED = 1,         /**< Operation successful, the record went through the spill file */
     RB_OK = 0,              /**< Operation successful */
     RB_FULL = -1,           /**< Buffer is full */
     RB_EMPTY = -2,          /**< Buffer is empty */
@@ -28,6 +29,14 @@ enum {
     RB_MEMORY_FAIL = -5     /**< Memory allocation failure */
 };
 
+/**
+ * @enum
+ * @brief How the Ring Buffer memory was allocated, kept in ring_buf_t::flags
+ */
+enum {
+    RB_ALLOC_MMAP = 1 << 0, /**< Anonymous mapping: released with munmap(), pages can be given back */
+};
+
 /**
  * @struct
  * @author Sebastian Mountaniol (04/03/2025)
@@ -44,6 +53,21 @@ struct ring_buf_cell_struct {
 
 typedef struct ring_buf_cell_struct cell_t;
 
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Busy-wait hint: tell the CPU we spin on a shared variable
+ */
+static inline void rb_cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    atomic_signal_fence(memory_order_seq_cst);
+#endif
+}
+
 /**
  * @struct
  * @author Sebastian Mountaniol (04/03/2025)
@@ -57,6 +81,7 @@ typedef struct {
     uint64_t max_alloc_size; /**< Max allowed allocation size */
     uint64_t head;           /**< Consumer read index */
     uint64_t tail;           /**< Producer write index */
+    uint64_t flags;          /**< Allocation flags, RB_ALLOC_* */
 #if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) // 64-bit
     // No padding needed; all fields naturally aligned
 #else
@@ -78,6 +103,14 @@ typedef struct {
  */
 ring_buf_t *rb_alloc_init(size_t num_cells, size_t max_alloc_size);
 
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Calculate the memory size of a Ring Buffer: the control structure and the cells
+ * @param size_t num_cells     How many records should be in the Ring Buffer
+ * @return size_t Size in bytes
+ */
+size_t rb_mem_size(size_t num_cells);
+
 
 /**
  * @author Sebastian Mountaniol (04/03/2025)
@@ -110,6 +143,72 @@ int rb_push_ptr(ring_buf_t *d, void *data, size_t size);
  */
 int rb_pull_ptr(ring_buf_t *d, void **data, size_t *size);
 
+/* Maximal prefetch distance of rb_pull_ptr_prefetch(), in records */
+#define RB_PREFETCH_MAX_DEPTH 16
+/* How many bytes of every payload are prefetched */
+#define RB_PREFETCH_MAX_BYTES 256
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer from the Ring Buffer, and prefetch the payloads of the next records
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param void** data  Double pointer; must point to NULL, the pointer to a buffer will be copied into
+ * @param size_t* size  Must point to 0; size of returned buffer
+ * @param unsigned int depth Prefetch distance in records; 0 means adaptive: as deep as the occupancy allows,
+ *        up to RB_PREFETCH_MAX_DEPTH
+ * @return int RB_OK on success, RB_PARAM_ERROR if one of input pointers is invalid; RB_EMPTY if the Ring
+ *         Buffer is empty
+ * @details The payloads are written by the producer on another core, so dereferencing each one is a cache
+ *          miss. While returning record i, the payload of record i + depth is prefetched (up to
+ *          RB_PREFETCH_MAX_BYTES of it), so by the time the consumer gets there it is already on the way. When
+ *          fewer records are readable, the farthest one is prefetched: one prefetch per pull in any case.
+ */
+int rb_pull_ptr_prefetch(ring_buf_t *d, void **data, size_t *size, unsigned int depth);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull up to max buffers at once, prefetching all their payloads
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param void** data  Array of max pointers, the buffer pointers are copied into
+ * @param size_t* sizes Array of max sizes, the buffer sizes are copied into
+ * @param size_t max   Size of the arrays
+ * @param size_t* pulled Output: how many buffers were pulled
+ * @return int RB_OK if at least one buffer is pulled, RB_EMPTY if the Ring Buffer is empty, RB_PARAM_ERROR if
+ *         one of input pointers is invalid
+ * @details The head index is published once for the whole batch
+ */
+int rb_pull_ptr_batch(ring_buf_t *d, void **data, size_t *sizes, size_t max, size_t *pulled);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the readable cells which are contiguous in memory, without removing them (consumer side)
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param cell_t** cells Output: the first readable cell
+ * @return size_t Number of readable cells from *cells up to the end of the array; 0 if the Ring Buffer is empty
+ * @details When the readable records wrap around the end of the array, only the first part is returned; the
+ *          rest comes with the next call after rb_release_span(). The cells stay valid until rb_release_span().
+ */
+size_t rb_peek_span(ring_buf_t *d, cell_t **cells);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Remove n records returned by rb_peek_span(), publishing head once (consumer side)
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param size_t n     How many records to remove, not more than rb_peek_span() returned
+ * @return int RB_OK on success, RB_PARAM_ERROR if the Ring Buffer is NULL or n is larger than the occupancy
+ */
+int rb_release_span(ring_buf_t *d, size_t n);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Copy up to n cells into the Ring Buffer, publishing tail once (producer side)
+ * @param ring_buf_t* d     Pointer to the Ring Buffer structure
+ * @param const cell_t* cells Cells to copy, e.g. from rb_peek_span() of another ring
+ * @param size_t n     Number of cells
+ * @return size_t Number of copied cells, limited by the free room; 0 if the Ring Buffer is full or on invalid input
+ */
+size_t rb_push_cells(ring_buf_t *d, const cell_t *cells, size_t n);
+
 /**
  * @author Sebastian Mountaniol (04/03/2025)
  * @brief Push an integer value to Ring Buffer
@@ -0,0 +1,222 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements adaptive producer batching: publish the tail after N records or T nanoseconds.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ring_buf_batch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define RB_BATCH_TSC 1
+#endif
+
+/* Duration of the TSC calibration */
+#define RB_BATCH_CALIBRATE_NS 2000000
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get current monotonic time in nanoseconds
+ * @return uint64_t Current time
+ */
+static inline uint64_t rb_batch_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read the clock of the time budget: the TSC on x86, nanoseconds elsewhere
+ * @return uint64_t Current time in clock ticks
+ */
+static inline uint64_t rb_batch_ticks(void)
+{
+#ifdef RB_BATCH_TSC
+    return __rdtsc();
+#else
+    return rb_batch_now_ns();
+#endif
+}
+
+/* Clock ticks per nanosecond, measured once by rb_batch_calibrate() */
+static double rb_batch_ticks_per_ns = 1.0;
+static pthread_once_t rb_batch_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Measure the TSC frequency against the monotonic clock
+ */
+static void rb_batch_calibrate(void)
+{
+#ifdef RB_BATCH_TSC
+    struct timespec nap = { .tv_sec = 0, .tv_nsec = RB_BATCH_CALIBRATE_NS };
+    uint64_t start_ns = rb_batch_now_ns();
+    uint64_t start_ticks = __rdtsc();
+
+    nanosleep(&nap, NULL);
+
+    uint64_t ticks = __rdtsc() - start_ticks;
+    uint64_t ns = rb_batch_now_ns() - start_ns;
+
+    if (ns > 0 && ticks > 0) rb_batch_ticks_per_ns = (double)ticks / (double)ns;
+#endif
+}
+
+int rb_batch_init(rb_batch_t *b, ring_buf_t *ring, uint32_t max_batch, uint64_t budget_ns)
+{
+    if (!b || !ring) return RB_PARAM_ERROR;
+
+    if (0 == max_batch) max_batch = RB_BATCH_MAX;
+    if (max_batch >= ring->capacity) return RB_PARAM_ERROR;
+    if (0 == budget_ns) budget_ns = RB_BATCH_BUDGET_NS;
+
+    pthread_once(&rb_batch_once, rb_batch_calibrate);
+
+    memset(b, 0, sizeof(rb_batch_t));
+    b->ring = ring;
+    b->tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    b->published = b->tail;
+    b->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    b->budget_ticks = (uint64_t)((double)budget_ns * rb_batch_ticks_per_ns);
+    b->max_batch = max_batch;
+    /* Start with the lowest latency, grow under load */
+    b->threshold = 1;
+
+    return RB_OK;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Publish the local tail, then adapt the count threshold to the consumer
+ * @param rb_batch_t* b     Producer
+ * @param int timeout 1 if the publish is caused by the time budget
+ */
+static void rb_batch_publish(rb_batch_t *b, int timeout)
+{
+    ring_buf_t *d = b->ring;
+    uint64_t head;
+
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&d->tail, b->tail, memory_order_release);
+
+    /* One read of the consumer index per publish, not per record */
+    head = atomic_load_explicit(&d->head, memory_order_acquire);
+
+    if (timeout || head == b->published) {
+        /* The rate is low, or the consumer waits for data: batching only adds latency */
+        if (b->threshold > 1) b->threshold >>= 1;
+    } else if (b->tail - head > d->capacity / 2) {
+        /* The consumer falls behind: fewer, larger publishes */
+        b->threshold = b->threshold * 2 < b->max_batch ? b->threshold * 2 : b->max_batch;
+    }
+
+    b->cached_head = head;
+    b->published = b->tail;
+    b->publishes++;
+    b->timeouts += timeout;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the next free cell, or publish and fail if the ring is full
+ * @param rb_batch_t* b     Producer
+ * @return cell_t* Free cell; NULL if the ring is full
+ */
+static inline cell_t *rb_batch_cell(rb_batch_t *b)
+{
+    ring_buf_t *d = b->ring;
+
+    /* One cell always stays empty, as in rb_push_int() */
+    if (b->tail - b->cached_head >= d->capacity - 1) {
+        b->cached_head = atomic_load_explicit(&d->head, memory_order_acquire);
+        if (b->tail - b->cached_head >= d->capacity - 1) {
+            /* Let the consumer see everything, it is the only way the ring gets free */
+            if (b->tail != b->published) rb_batch_publish(b, 0);
+            return NULL;
+        }
+    }
+
+    return &d->cells[b->tail & (d->capacity - 1)];
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Account the record just written, publish if the count threshold or the time budget is reached
+ * @param rb_batch_t* b     Producer
+ */
+static inline void rb_batch_commit(rb_batch_t *b)
+{
+    uint64_t pending = ++b->tail - b->published;
+
+    b->records++;
+
+    if (pending >= b->threshold) {
+        rb_batch_publish(b, 0);
+    } else if (1 == pending) {
+        b->first_ticks = rb_batch_ticks();
+    } else if ((pending < RB_BATCH_CHECK_EVERY || 0 == (pending & (RB_BATCH_CHECK_EVERY - 1))) &&
+               rb_batch_ticks() - b->first_ticks >= b->budget_ticks) {
+        /* A small batch is checked at every push: a stream which went quiet after a burst keeps a large
+         * threshold, and must not hold its first records for many inter-arrival gaps */
+        rb_batch_publish(b, 1);
+    }
+}
+
+__attribute__((hot))
+int rb_batch_push_int(rb_batch_t *b, int64_t idata)
+{
+    if (!b) return RB_PARAM_ERROR;
+
+    cell_t *cell = rb_batch_cell(b);
+
+    if (NULL == cell) return RB_FULL;
+
+    cell->idata = idata;
+    rb_batch_commit(b);
+
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_batch_push_ptr(rb_batch_t *b, void *data, size_t size)
+{
+    if (!b) return RB_PARAM_ERROR;
+
+    cell_t *cell = rb_batch_cell(b);
+
+    if (NULL == cell) return RB_FULL;
+
+    cell->data = data;
+    cell->size = size;
+    rb_batch_commit(b);
+
+    return RB_OK;
+}
+
+int rb_batch_flush(rb_batch_t *b)
+{
+    if (!b) return RB_PARAM_ERROR;
+    if (b->tail == b->published) return RB_EMPTY;
+
+    rb_batch_publish(b, 0);
+    return RB_OK;
+}
+
+int rb_batch_poll(rb_batch_t *b)
+{
+    if (!b) return RB_PARAM_ERROR;
+    if (b->tail == b->published) return RB_EMPTY;
+    if (rb_batch_ticks() - b->first_ticks < b->budget_ticks) return RB_EMPTY;
+
+    rb_batch_publish(b, 1);
+    return RB_OK;
+}
@@ -0,0 +1,95 @@
+#ifndef RING_BUF_BATCH_H
+#define RING_BUF_BATCH_H
+
+#include "ring_buf.h"
+
+/* Default largest batch: the count threshold never grows above it */
+#define RB_BATCH_MAX 256
+/* Default time budget: the oldest unpublished record never waits longer */
+#define RB_BATCH_BUDGET_NS 5000
+/* The clock is read at every push while fewer records are pending, then every that many records, power of 2 */
+#define RB_BATCH_CHECK_EVERY 16
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Adaptive producer batching ("N records or T nanoseconds") over a plain ring
+ * @details The producer writes the cells as usual but keeps the tail index to itself, and publishes it when
+ *          the count threshold is reached or when the oldest unpublished record is older than the time budget,
+ *          whichever comes first. The time is read from the TSC on x86 (calibrated once), from the monotonic
+ *          clock elsewhere, at every push while less than RB_BATCH_CHECK_EVERY records are pending and then
+ *          every RB_BATCH_CHECK_EVERY records. The budget is checked only by a push or by rb_batch_poll(): a
+ *          producer which needs the latency bound between pushes must call rb_batch_poll().
+ *          The threshold adapts to the consumer at every publish: if the consumer has drained everything
+ *          published before, or the budget expired, it is halved (down to 1: a record per publish, lowest
+ *          latency); if the ring is more than half full, it is doubled (up to max_batch: fewer tail updates, the
+ *          consumer reads whole batches). The consumer side is unchanged.
+ */
+typedef struct {
+    ring_buf_t *ring;        /**< Ring, this producer is its only producer */
+    uint64_t tail;           /**< Local tail: next cell to write */
+    uint64_t published;      /**< Tail value last published to the consumer */
+    uint64_t cached_head;    /**< Last seen consumer index */
+    uint64_t first_ticks;    /**< When the oldest unpublished record was written */
+    uint64_t budget_ticks;   /**< Time budget, in clock ticks */
+    uint32_t threshold;      /**< Current count threshold */
+    uint32_t max_batch;      /**< Largest count threshold */
+    uint64_t records;        /**< Statistics: records written */
+    uint64_t publishes;      /**< Statistics: tail updates */
+    uint64_t timeouts;       /**< Statistics: publishes caused by the time budget */
+} rb_batch_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Init the adaptive batching producer
+ * @param rb_batch_t* b     Producer to init
+ * @param ring_buf_t* ring  Ring; its current tail is taken over, do not push to it directly any more
+ * @param uint32_t max_batch Largest count threshold, less than the ring capacity; 0 for RB_BATCH_MAX
+ * @param uint64_t budget_ns Time budget in nanoseconds; 0 for RB_BATCH_BUDGET_NS
+ * @return int RB_OK on success, RB_PARAM_ERROR on invalid input
+ */
+int rb_batch_init(rb_batch_t *b, ring_buf_t *ring, uint32_t max_batch, uint64_t budget_ns);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write an integer value, publish if a threshold is reached
+ * @param rb_batch_t* b     Producer
+ * @param int64_t idata Integer value
+ * @return int RB_OK if written, RB_FULL if the ring is full (everything written before is published then),
+ *         RB_PARAM_ERROR if the producer is NULL
+ */
+__attribute__((hot))
+int rb_batch_push_int(rb_batch_t *b, int64_t idata);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write a pointer and the buffer size, publish if a threshold is reached
+ * @param rb_batch_t* b     Producer
+ * @param void* data  Pointer to a buffer
+ * @param size_t size  Size of the buffer
+ * @return int RB_OK if written, RB_FULL if the ring is full (everything written before is published then),
+ *         RB_PARAM_ERROR if the producer is NULL
+ */
+__attribute__((hot))
+int rb_batch_push_ptr(rb_batch_t *b, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Publish everything written so far, regardless of the thresholds
+ * @param rb_batch_t* b     Producer
+ * @return int RB_OK if something was published, RB_EMPTY if nothing was pending, RB_PARAM_ERROR if the producer
+ *         is NULL
+ */
+int rb_batch_flush(rb_batch_t *b);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Publish if the time budget of the oldest unpublished record expired
+ * @param rb_batch_t* b     Producer
+ * @return int RB_OK if something was published, RB_EMPTY if not, RB_PARAM_ERROR if the producer is NULL
+ * @details Call it when the producer has nothing to push for a while, so the last records of a burst do not wait
+ *          for the next push. A producer which goes idle for long should call rb_batch_flush() instead.
+ */
+int rb_batch_poll(rb_batch_t *b);
+
+#endif // RING_BUF_BATCH_H
@@ -0,0 +1,150 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a channel of preallocated columnar batches, exchanged by ownership handoff.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_col.h"
+
+/* Size of one value of every column type */
+static const uint8_t rb_col_type_size[RB_COL_NUM_TYPES] = {
+    [RB_COL_I64] = sizeof(int64_t),
+    [RB_COL_U64] = sizeof(uint64_t),
+    [RB_COL_F64] = sizeof(double),
+    [RB_COL_I32] = sizeof(int32_t),
+    [RB_COL_U32] = sizeof(uint32_t),
+    [RB_COL_F32] = sizeof(float),
+    [RB_COL_U8] = sizeof(uint8_t),
+};
+
+/* Round up to the cache line */
+#define RB_COL_ALIGN(x) (((x) + 63) & ~(size_t)63)
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate a ring large enough to hold n pointers
+ * @param size_t n     Number of pointers
+ * @return ring_buf_t* Allocated ring; NULL on error
+ */
+static ring_buf_t *rb_col_ring_alloc(size_t n)
+{
+    size_t cells = 2;
+
+    /* One cell always stays empty */
+    while (cells < n + 1) cells <<= 1;
+
+    return rb_alloc_init(cells, rb_mem_size(cells));
+}
+
+rb_col_chan_t *rb_col_chan_alloc_init(size_t num_batches, size_t rows, const uint8_t *types, size_t num_cols,
+                                      size_t max_alloc_size)
+{
+    rb_col_chan_t *ch;
+    size_t stride;
+
+    if (0 == num_batches || 0 == rows || rows > UINT32_MAX || !types || 0 == num_cols ||
+        num_cols > RB_COL_MAX_COLS) {
+        return NULL;
+    }
+
+    stride = sizeof(rb_col_batch_t);
+    for (size_t c = 0; c < num_cols; c++) {
+        if (types[c] >= RB_COL_NUM_TYPES) return NULL;
+        if (rows > max_alloc_size / rb_col_type_size[types[c]]) return NULL;
+        stride += RB_COL_ALIGN(rows * rb_col_type_size[types[c]]);
+        if (stride > max_alloc_size) return NULL;
+    }
+
+    if (num_batches > max_alloc_size / stride) {
+        return NULL;
+    }
+
+    ch = calloc(1, sizeof(rb_col_chan_t));
+    if (NULL == ch) {
+        perror("Can not allocate memory: ");
+        return NULL;
+    }
+
+    ch->num_batches = num_batches;
+    ch->stride = stride;
+    ch->forward = rb_col_ring_alloc(num_batches);
+    ch->returns = rb_col_ring_alloc(num_batches);
+    ch->batches = aligned_alloc(64, num_batches * stride);
+    if (NULL == ch->forward || NULL == ch->returns || NULL == ch->batches) {
+        rb_col_chan_destroy(ch);
+        return NULL;
+    }
+
+    memset(ch->batches, 0, num_batches * stride);
+
+    for (size_t i = 0; i < num_batches; i++) {
+        rb_col_batch_t *batch = (rb_col_batch_t *)(ch->batches + i * stride);
+        char *col = (char *)batch + sizeof(rb_col_batch_t);
+
+        batch->capacity = rows;
+        batch->num_cols = num_cols;
+        batch->index = i;
+        for (size_t c = 0; c < num_cols; c++) {
+            batch->types[c] = types[c];
+            batch->cols[c] = col;
+            col += RB_COL_ALIGN(rows * rb_col_type_size[types[c]]);
+        }
+
+        /* All batches start in the return ring: free for the producer */
+        rb_push_ptr(ch->returns, batch, stride);
+    }
+
+    return ch;
+}
+
+void rb_col_chan_destroy(rb_col_chan_t *ch)
+{
+    if (!ch) return;
+
+    rb_destroy(ch->forward);
+    rb_destroy(ch->returns);
+    free(ch->batches);
+    free(ch);
+}
+
+rb_col_batch_t *rb_col_acquire(rb_col_chan_t *ch)
+{
+    void *batch = NULL;
+    size_t size = 0;
+
+    if (!ch || RB_OK != rb_pull_ptr(ch->returns, &batch, &size)) return NULL;
+
+    ((rb_col_batch_t *)batch)->rows = 0;
+    return batch;
+}
+
+int rb_col_send(rb_col_chan_t *ch, rb_col_batch_t *batch)
+{
+    if (!ch || !batch || batch->rows > batch->capacity) return RB_PARAM_ERROR;
+
+    /* The ring holds all batches, it can not be full */
+    return rb_push_ptr(ch->forward, batch, ch->stride);
+}
+
+rb_col_batch_t *rb_col_recv(rb_col_chan_t *ch)
+{
+    void *batch = NULL;
+    size_t size = 0;
+
+    if (!ch || RB_OK != rb_pull_ptr(ch->forward, &batch, &size)) return NULL;
+
+    return batch;
+}
+
+int rb_col_return(rb_col_chan_t *ch, rb_col_batch_t *batch)
+{
+    if (!ch || !batch) return RB_PARAM_ERROR;
+
+    return rb_push_ptr(ch->returns, batch, ch->stride);
+}
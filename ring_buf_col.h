@@ -0,0 +1,115 @@
+#ifndef RING_BUF_COL_H
+#define RING_BUF_COL_H
+
+#include "ring_buf.h"
+
+/* Maximal number of columns in a batch */
+#define RB_COL_MAX_COLS 32
+
+/**
+ * @enum
+ * @brief Column types
+ */
+enum {
+    RB_COL_I64 = 0,         /**< int64_t */
+    RB_COL_U64,             /**< uint64_t */
+    RB_COL_F64,             /**< double */
+    RB_COL_I32,             /**< int32_t */
+    RB_COL_U32,             /**< uint32_t */
+    RB_COL_F32,             /**< float */
+    RB_COL_U8,              /**< uint8_t */
+    RB_COL_NUM_TYPES        /**< Number of types */
+};
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Columnar batch: fixed row capacity, one array per field; the columns follow the header
+ * @details Every column starts on a cache line and its size is rounded up to a cache line, so scanning a single
+ *          field touches only the lines of that field and the compiler can vectorize the loop.
+ */
+typedef struct {
+    uint32_t rows;           /**< Rows filled by the producer */
+    uint32_t capacity;       /**< Row capacity */
+    uint32_t num_cols;       /**< Number of columns */
+    uint32_t index;          /**< Index of the batch in its channel */
+    uint8_t types[RB_COL_MAX_COLS]; /**< RB_COL_* type of every column */
+    void *cols[RB_COL_MAX_COLS];    /**< Column arrays, 64 bytes aligned */
+} __attribute__((aligned(64))) rb_col_batch_t;
+
+/* A column of a batch as a typed array, e.g. RB_COL(batch, 0, int64_t) */
+#define RB_COL(batch, col, type) ((type *)(batch)->cols[(col)])
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Channel of preallocated columnar batches
+ * @details All batches are allocated once, in one block. The producer takes a free batch (rb_col_acquire()),
+ *          fills its columns and hands it over with rb_col_send(); only the batch pointer goes through the
+ *          forward ring, the data is never copied. The consumer takes it with rb_col_recv(), scans the columns
+ *          and gives it back with rb_col_return() through the return ring, where the producer picks it up again.
+ *          Both rings are SPSC ring_buf_t, large enough for all batches, so sending and returning never fail.
+ */
+typedef struct {
+    size_t num_batches;      /**< Number of batches */
+    size_t stride;           /**< Distance between two batches, bytes */
+    ring_buf_t *forward;     /**< Producer -> consumer: filled batches */
+    ring_buf_t *returns;     /**< Consumer -> producer: free batches */
+    char *batches;           /**< Headers and columns of all batches, one block */
+} rb_col_chan_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate the channel and all its batches
+ * @param size_t num_batches Number of batches
+ * @param size_t rows  Row capacity of every batch
+ * @param const uint8_t* types Type of every column, RB_COL_*
+ * @param size_t num_cols Number of columns, up to RB_COL_MAX_COLS
+ * @param size_t max_alloc_size Maximum allowed memory to allocate for the batches
+ * @return rb_col_chan_t* Allocated channel; NULL on error
+ */
+rb_col_chan_t *rb_col_chan_alloc_init(size_t num_batches, size_t rows, const uint8_t *types, size_t num_cols,
+                                      size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the channel and all its batches
+ * @param rb_col_chan_t* ch    Channel
+ */
+void rb_col_chan_destroy(rb_col_chan_t *ch);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Take a free batch (producer side)
+ * @param rb_col_chan_t* ch    Channel
+ * @return rb_col_batch_t* Empty batch (rows = 0), owned by the producer now; NULL if all batches are in use
+ */
+rb_col_batch_t *rb_col_acquire(rb_col_chan_t *ch);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Hand a filled batch to the consumer (producer side)
+ * @param rb_col_chan_t* ch    Channel
+ * @param rb_col_batch_t* batch Batch from rb_col_acquire(), with rows set
+ * @return int RB_OK on success, RB_PARAM_ERROR on invalid input
+ */
+int rb_col_send(rb_col_chan_t *ch, rb_col_batch_t *batch);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Take the next filled batch (consumer side)
+ * @param rb_col_chan_t* ch    Channel
+ * @return rb_col_batch_t* Batch, owned by the consumer until rb_col_return(); NULL if there is none
+ */
+rb_col_batch_t *rb_col_recv(rb_col_chan_t *ch);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Give a processed batch back to the producer (consumer side)
+ * @param rb_col_chan_t* ch    Channel
+ * @param rb_col_batch_t* batch Batch from rb_col_recv()
+ * @return int RB_OK on success, RB_PARAM_ERROR on invalid input
+ */
+int rb_col_return(rb_col_chan_t *ch, rb_col_batch_t *batch);
+
+#endif // RING_BUF_COL_H
@@ -0,0 +1,119 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a conflating keyed queue: seqlock protected slots and a ring of dirty keys.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_cq.h"
+
+#define RB_CQ_SLOT(cq, key) ((rb_cq_slot_t *)((cq)->slots + (size_t)(key) * (cq)->stride))
+#define RB_CQ_VALUE(slot) ((char *)(slot) + sizeof(rb_cq_slot_t))
+
+rb_cq_t *rb_cq_alloc_init(size_t num_keys, size_t value_size, size_t max_alloc_size)
+{
+    size_t total_memory, stride;
+    size_t ring_cells = 2;
+    rb_cq_t *cq;
+
+    if (0 == num_keys || num_keys > UINT32_MAX || 0 == value_size) return NULL;
+
+    stride = (sizeof(rb_cq_slot_t) + value_size + 63) & ~(size_t)63;
+    total_memory = sizeof(rb_cq_t) + num_keys * stride;
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    cq = aligned_alloc(64, total_memory);
+    if (NULL == cq) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(cq, 0, total_memory);
+    cq->num_keys = num_keys;
+    cq->value_size = value_size;
+    cq->stride = stride;
+
+    /* Every key is queued at most once, so the ring never gets full */
+    while (ring_cells < num_keys + 1) ring_cells <<= 1;
+    cq->keys = rb_alloc_init(ring_cells, rb_mem_size(ring_cells));
+    if (NULL == cq->keys) {
+        free(cq);
+        return NULL;
+    }
+
+    return cq;
+}
+
+void rb_cq_destroy(rb_cq_t *cq)
+{
+    if (!cq) return;
+
+    rb_destroy(cq->keys);
+    free(cq);
+}
+
+__attribute__((hot))
+int rb_cq_update(rb_cq_t *cq, uint32_t key, const void *value)
+{
+    if (!cq || !value || key >= cq->num_keys) return RB_PARAM_ERROR;
+
+    rb_cq_slot_t *slot = RB_CQ_SLOT(cq, key);
+    uint64_t seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(RB_CQ_VALUE(slot), value, cq->value_size);
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+
+    cq->updates++;
+
+    /* Pairs with the fence in rb_cq_poll(): either the consumer sees this value, or the key is queued again */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_exchange_explicit(&slot->queued, 1, memory_order_relaxed)) {
+        cq->conflated++;
+        return RB_OK;
+    }
+
+    return rb_push_int(cq->keys, key);
+}
+
+__attribute__((hot))
+int rb_cq_poll(rb_cq_t *cq, uint32_t *key, void *value)
+{
+    int64_t k;
+
+    if (!cq || !key || !value) return RB_PARAM_ERROR;
+
+    int rc = rb_pull_int(cq->keys, &k);
+    if (RB_OK != rc) return rc;
+
+    rb_cq_slot_t *slot = RB_CQ_SLOT(cq, k);
+
+    /* Clear the flag before reading: an update from now on queues the key again */
+    atomic_store_explicit(&slot->queued, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    for (;;) {
+        uint64_t seq1 = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq1 & 1) { // The producer is writing
+            rb_cpu_relax();
+            continue;
+        }
+
+        memcpy(value, RB_CQ_VALUE(slot), cq->value_size);
+        atomic_thread_fence(memory_order_acquire);
+
+        if (atomic_load_explicit(&slot->seq, memory_order_relaxed) == seq1) break;
+        rb_cpu_relax();
+    }
+
+    *key = (uint32_t)k;
+    return RB_OK;
+}
@@ -0,0 +1,76 @@
+#ifndef RING_BUF_CQ_H
+#define RING_BUF_CQ_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One key slot of the conflating queue; the value follows the header
+ */
+typedef struct {
+    uint64_t seq;            /**< Seqlock: odd while the producer writes the value */
+    uint32_t queued;         /**< 1 while the key is in the dirty keys ring */
+    uint32_t _pad;
+} rb_cq_slot_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Conflating keyed queue: keeps only the latest value of every key
+ * @details Every key of the fixed key space [0, num_keys) has a slot, protected by a seqlock. An update
+ *          overwrites the value in place, and the key is pushed into the dirty keys ring (a ring_buf_t) only if
+ *          it is not there yet. So during a burst the consumer work is bounded by the number of distinct keys,
+ *          not by the number of updates, and it always reads the latest value. The dirty keys ring holds every
+ *          key, so an update never fails. One producer, one consumer.
+ */
+typedef struct {
+    uint64_t num_keys;       /**< Size of the key space */
+    uint64_t value_size;     /**< Size of one value */
+    uint64_t stride;         /**< Distance between two slots, cache line aligned */
+    ring_buf_t *keys;        /**< Dirty keys, producer -> consumer */
+    uint64_t updates __attribute__((aligned(64))); /**< Producer: number of updates */
+    uint64_t conflated;      /**< Producer: updates of a key which was already queued */
+    char slots[] __attribute__((aligned(64)));     /**< Key slots */
+} rb_cq_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the conflating queue
+ * @param size_t num_keys   Size of the key space
+ * @param size_t value_size Size of one value
+ * @param size_t max_alloc_size Maximum allowed memory to allocate for the slots
+ * @return rb_cq_t* Allocated and inited queue; NULL on error
+ */
+rb_cq_t *rb_cq_alloc_init(size_t num_keys, size_t value_size, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the conflating queue
+ * @param rb_cq_t* cq    Queue to free
+ */
+void rb_cq_destroy(rb_cq_t *cq);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Set the latest value of a key (producer side)
+ * @param rb_cq_t* cq    Queue
+ * @param uint32_t key   Key, less than num_keys
+ * @param const void* value Value of value_size bytes
+ * @return int RB_OK, or RB_PARAM_ERROR on invalid input
+ */
+__attribute__((hot))
+int rb_cq_update(rb_cq_t *cq, uint32_t key, const void *value);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Take the next updated key and its latest value (consumer side)
+ * @param rb_cq_t* cq    Queue
+ * @param uint32_t* key  Output: the key
+ * @param void* value Output: value_size bytes, the latest value of the key
+ * @return int RB_OK if a key is returned, RB_EMPTY if no key was updated, RB_PARAM_ERROR on invalid input
+ */
+__attribute__((hot))
+int rb_cq_poll(rb_cq_t *cq, uint32_t *key, void *value);
+
+#endif // RING_BUF_CQ_H
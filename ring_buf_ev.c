@@ -0,0 +1,122 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements an SPSC ring of preallocated event objects, filled and read in place.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_ev.h"
+
+rb_ev_t *rb_ev_alloc_init(size_t num_cells, size_t event_size, size_t max_alloc_size, rb_ev_init_fn_t init_fn,
+                          void *ctx)
+{
+    size_t total_memory;
+    size_t stride;
+    rb_ev_t *r;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    /* The control structure alone must fit, else the subtraction below wraps around */
+    if (0 == event_size || max_alloc_size < sizeof(rb_ev_t) || event_size > max_alloc_size) {
+        return NULL;
+    }
+
+    stride = (event_size + 63) & ~(size_t)63;
+    if (stride > (max_alloc_size - sizeof(rb_ev_t)) / num_cells) {
+        return NULL;
+    }
+
+    total_memory = sizeof(rb_ev_t) + num_cells * stride;
+
+    r = aligned_alloc(64, total_memory);
+    if (NULL == r) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(r, 0, total_memory);
+    r->capacity = num_cells;
+    r->max_alloc_size = max_alloc_size;
+    r->event_size = event_size;
+    r->stride = stride;
+
+    if (init_fn) {
+        for (uint64_t i = 0; i < num_cells; i++) {
+            init_fn(rb_ev_at(r, i), i, ctx);
+        }
+    }
+
+    return r;
+}
+
+void rb_ev_destroy(rb_ev_t *r)
+{
+    free(r);
+}
+
+__attribute__((hot))
+int rb_ev_claim(rb_ev_t *r, void **event)
+{
+    if (!r || !event) return RB_PARAM_ERROR;
+
+    uint64_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+    if (tail - r->cached_head == r->capacity) {
+        r->cached_head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (tail - r->cached_head == r->capacity) return RB_FULL; // Buffer is full
+    }
+
+    *event = rb_ev_at(r, tail);
+    r->claimed = 1;
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_ev_publish(rb_ev_t *r)
+{
+    if (!r) return RB_PARAM_ERROR;
+
+    if (!r->claimed) return RB_FULL; // Nothing was claimed
+
+    uint64_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+    r->claimed = 0;
+    atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_ev_peek(rb_ev_t *r, void **event)
+{
+    if (!r || !event) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+
+    if (head == r->cached_tail) {
+        r->cached_tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+        if (head == r->cached_tail) return RB_EMPTY; // Buffer is empty
+    }
+
+    *event = rb_ev_at(r, head);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_ev_release(rb_ev_t *r)
+{
+    if (!r) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    if (head == r->cached_tail) return RB_EMPTY;
+
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+    return RB_OK;
+}
@@ -0,0 +1,109 @@
+#ifndef RING_BUF_EV_H
+#define RING_BUF_EV_H
+
+#include "ring_buf.h"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Event factory: called once for every preallocated event
+ * @param void* event Zeroed event memory to init
+ * @param uint64_t index Index of the event in the ring
+ * @param void* ctx   User context
+ */
+typedef void (*rb_ev_init_fn_t)(void *event, uint64_t index, void *ctx);
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Lock-free SPSC ring of preallocated, reusable event objects
+ * @details The ring owns capacity user-defined events, created once by the factory callback. The producer
+ *          claims the next free event and fills it in place (rb_ev_claim() / rb_ev_publish()), the consumer
+ *          reads it in place (rb_ev_peek() / rb_ev_release()); nothing is allocated or copied, the events are
+ *          recycled forever. Every event starts on its own cache line (the stride is the event size rounded up
+ *          to 64 bytes). The control structure and the events are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t capacity;       /**< Number of events (power of 2) */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t event_size;     /**< Size of one event as given by the user */
+    uint64_t stride;         /**< Distance between two events: event_size rounded up to the cache line */
+    uint64_t tail __attribute__((aligned(64))); /**< Producer write index */
+    uint64_t cached_head;    /**< Producer: last seen consumer index */
+    uint64_t claimed;        /**< Producer: 1 between rb_ev_claim() and rb_ev_publish() */
+    uint64_t head __attribute__((aligned(64))); /**< Consumer read index */
+    uint64_t cached_tail;    /**< Consumer: last seen producer index */
+    uint8_t events[] __attribute__((aligned(64))); /**< The events */
+} rb_ev_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get an event by its sequence
+ * @param rb_ev_t* r     Ring
+ * @param uint64_t seq   Sequence (any position; the index is taken modulo capacity)
+ * @return void* The event
+ */
+static inline void *rb_ev_at(rb_ev_t *r, uint64_t seq)
+{
+    return r->events + (seq & (r->capacity - 1)) * r->stride;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate the ring and create all the events
+ * @param size_t num_cells     How many events should be in the ring, power of 2
+ * @param size_t event_size    Size of one event
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @param rb_ev_init_fn_t init_fn Event factory, called for every event; can be NULL: the events are zeroed
+ * @param void* ctx   Factory context
+ * @return rb_ev_t* Allocated and inited ring; NULL on error
+ */
+rb_ev_t *rb_ev_alloc_init(size_t num_cells, size_t event_size, size_t max_alloc_size, rb_ev_init_fn_t init_fn,
+                          void *ctx);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the ring and its events
+ * @param rb_ev_t* r     Ring to free
+ */
+void rb_ev_destroy(rb_ev_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the next free event to fill in place (producer side)
+ * @param rb_ev_t* r     Ring
+ * @param void** event Output: the event; it keeps whatever the previous use left in it
+ * @return int RB_OK on success, RB_FULL if all events are held by the consumer, RB_PARAM_ERROR on invalid input
+ * @details The same event is returned until rb_ev_publish() is called
+ */
+__attribute__((hot))
+int rb_ev_claim(rb_ev_t *r, void **event);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Hand the claimed event to the consumer (producer side)
+ * @param rb_ev_t* r     Ring
+ * @return int RB_OK on success, RB_FULL if no event is claimed, RB_PARAM_ERROR if the ring is NULL
+ */
+__attribute__((hot))
+int rb_ev_publish(rb_ev_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the next published event, read it in place (consumer side)
+ * @param rb_ev_t* r     Ring
+ * @param void** event Output: the event, valid until rb_ev_release()
+ * @return int RB_OK on success, RB_EMPTY if the ring is empty, RB_PARAM_ERROR on invalid input
+ */
+__attribute__((hot))
+int rb_ev_peek(rb_ev_t *r, void **event);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Give the event returned by rb_ev_peek() back to the producer (consumer side)
+ * @param rb_ev_t* r     Ring
+ * @return int RB_OK on success, RB_EMPTY if the ring is empty, RB_PARAM_ERROR if the ring is NULL
+ */
+__attribute__((hot))
+int rb_ev_release(rb_ev_t *r);
+
+#endif // RING_BUF_EV_H
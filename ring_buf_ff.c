@@ -0,0 +1,127 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a FastForward-style SPSC ring: one cache line per slot, with an embedded sequence word.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_ff.h"
+
+rb_ff_t *rb_ff_alloc_init(size_t num_cells, size_t max_alloc_size)
+{
+    size_t total_memory;
+    rb_ff_t *r;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    total_memory = sizeof(rb_ff_t) + num_cells * sizeof(rb_ff_slot_t);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    r = aligned_alloc(64, total_memory);
+    if (NULL == r) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(r, 0, total_memory);
+    r->capacity = num_cells;
+    r->max_alloc_size = max_alloc_size;
+
+    /* Slot i is free for the producer position i */
+    for (size_t i = 0; i < num_cells; i++) {
+        atomic_init(&r->slots[i].seq, i);
+    }
+
+    return r;
+}
+
+void rb_ff_destroy(rb_ff_t *r)
+{
+    free(r);
+}
+
+int rb_ff_push_ptr(rb_ff_t *r, void *data, size_t size)
+{
+    if (!r) return RB_PARAM_ERROR;
+
+    uint64_t tail = r->tail;
+    rb_ff_slot_t *slot = &r->slots[tail & (r->capacity - 1)];
+
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) != tail) {
+        return RB_FULL; // The consumer did not release the slot yet
+    }
+
+    slot->data = data;
+    slot->size = size;
+    atomic_store_explicit(&slot->seq, tail + 1, memory_order_release);
+    r->tail = tail + 1;
+
+    return RB_OK;
+}
+
+int rb_ff_pull_ptr(rb_ff_t *r, void **data, size_t *size)
+{
+    if (!r || !data || !size) return RB_PARAM_ERROR;
+
+    uint64_t head = r->head;
+    rb_ff_slot_t *slot = &r->slots[head & (r->capacity - 1)];
+
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) != head + 1) {
+        return RB_EMPTY; // The producer did not fill the slot yet
+    }
+
+    *data = slot->data;
+    *size = slot->size;
+    atomic_store_explicit(&slot->seq, head + r->capacity, memory_order_release);
+    r->head = head + 1;
+
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_ff_push_int(rb_ff_t *r, int64_t idata)
+{
+    if (!r) return RB_PARAM_ERROR;
+
+    uint64_t tail = r->tail;
+    rb_ff_slot_t *slot = &r->slots[tail & (r->capacity - 1)];
+
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) != tail) {
+        return RB_FULL; // The consumer did not release the slot yet
+    }
+
+    slot->idata = idata;
+    atomic_store_explicit(&slot->seq, tail + 1, memory_order_release);
+    r->tail = tail + 1;
+
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_ff_pull_int(rb_ff_t *r, int64_t *idata)
+{
+    if (!r || !idata) return RB_PARAM_ERROR;
+
+    uint64_t head = r->head;
+    rb_ff_slot_t *slot = &r->slots[head & (r->capacity - 1)];
+
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) != head + 1) {
+        return RB_EMPTY; // The producer did not fill the slot yet
+    }
+
+    *idata = slot->idata;
+    atomic_store_explicit(&slot->seq, head + r->capacity, memory_order_release);
+    r->head = head + 1;
+
+    return RB_OK;
+}
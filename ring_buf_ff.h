@@ -0,0 +1,97 @@
+#ifndef RING_BUF_FF_H
+#define RING_BUF_FF_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One slot of the FastForward-style ring: the sequence word and the payload share one cache line
+ */
+typedef struct {
+    uint64_t seq;            /**< Slot state: == position: free for the producer; == position + 1: full */
+    union {
+        void *data;          /**< Pointer to the actual data */
+        int64_t idata;       /**< Or integer */
+    };
+    int64_t size;            /**< Size of the data */
+} __attribute__((aligned(64))) rb_ff_slot_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Lock-free SPSC ring where every slot carries its own sequence word (FastForward-style)
+ * @details In ring_buf_t the consumer reads the producer's tail index to learn that a cell is ready, and the
+ *          producer reads head to learn that a cell is free: two extra cache lines bounce between the cores
+ *          on every message. Here the consumer polls the sequence word of the slot itself and the producer
+ *          checks the sequence word of the slot it is about to write, so the indexes stay private to their
+ *          owners and the coherence traffic is limited to the data lines. All num_cells slots are usable.
+ *          The control structure and the slots are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t capacity;       /**< Number of slots (power of 2) */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t tail __attribute__((aligned(64))); /**< Producer write position, private to the producer */
+    uint64_t head __attribute__((aligned(64))); /**< Consumer read position, private to the consumer */
+    rb_ff_slot_t slots[];    /**< Ring data, one cache line per slot */
+} rb_ff_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the FastForward-style ring
+ * @param size_t num_cells     How many records should be in the ring, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @return rb_ff_t* Allocated and inited ring; NULL on error
+ */
+rb_ff_t *rb_ff_alloc_init(size_t num_cells, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the ring
+ * @param rb_ff_t* r     Ring to free
+ */
+void rb_ff_destroy(rb_ff_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a pointer and the buffer size in the ring
+ * @param rb_ff_t* r     Ring
+ * @param void* data  Pointer to a buffer to save
+ * @param size_t size  Size of the saved buffer
+ * @return int RB_OK if saved, RB_FULL if the ring is full, RB_PARAM_ERROR if the ring is NULL
+ */
+int rb_ff_push_ptr(rb_ff_t *r, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer from the ring
+ * @param rb_ff_t* r     Ring
+ * @param void** data  The pointer to a buffer will be copied into
+ * @param size_t* size  Size of returned buffer
+ * @return int RB_OK on success, RB_PARAM_ERROR if one of input pointers is invalid; RB_EMPTY if the ring is
+ *         empty
+ */
+int rb_ff_pull_ptr(rb_ff_t *r, void **data, size_t *size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Push an integer value to the ring
+ * @param rb_ff_t* r     Ring
+ * @param int64_t idata Integer value to save
+ * @return int RB_OK if saved, RB_FULL if the ring is full, RB_PARAM_ERROR if the ring is NULL
+ */
+__attribute__((hot))
+int rb_ff_push_int(rb_ff_t *r, int64_t idata);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Extract an integer value from the ring
+ * @param rb_ff_t* r     Ring
+ * @param int64_t* idata Pointer to integer, the value will be copied into
+ * @return int RB_OK if a value extracted; RB_PARAM_ERROR if one of pointers is invalid; RB_EMPTY if the ring is
+ *         empty
+ */
+__attribute__((hot))
+int rb_ff_pull_int(rb_ff_t *r, int64_t *idata);
+
+#endif // RING_BUF_FF_H
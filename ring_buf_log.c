@@ -0,0 +1,566 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements an asynchronous binary logger: the hot threads push raw arguments into their own rings,
+ * a background thread formats and writes them.
+ */
+
+#define _POSIX_C_SOURCE 200809L  // Enables POSIX API, including nanosleep and strnlen
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <time.h>
+#include "ring_buf_log.h"
+
+/* Record bytes taken by an argument of every type; a string takes at least its terminating zero */
+static const uint8_t rb_log_arg_size[RB_LOG_ARG_NUM] = {
+    [RB_LOG_ARG_INT] = sizeof(int),
+    [RB_LOG_ARG_LONG] = sizeof(long),
+    [RB_LOG_ARG_LLONG] = sizeof(long long),
+    [RB_LOG_ARG_SIZE] = sizeof(size_t),
+    [RB_LOG_ARG_INTMAX] = sizeof(intmax_t),
+    [RB_LOG_ARG_PTRDIFF] = sizeof(ptrdiff_t),
+    [RB_LOG_ARG_DOUBLE] = sizeof(double),
+    [RB_LOG_ARG_PTR] = sizeof(void *),
+    [RB_LOG_ARG_STR] = 1,
+};
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Copy a part of a format into a new string
+ * @param const char* start First byte
+ * @param size_t len   Number of bytes
+ * @param int unescape 1: replace "%%" with "%"
+ * @return char* The copy, NULL on allocation failure
+ */
+static char *rb_log_seg_dup(const char *start, size_t len, int unescape)
+{
+    char *seg = malloc(len + 1);
+    size_t out = 0;
+
+    if (NULL == seg) return NULL;
+
+    for (size_t i = 0; i < len; i++) {
+        seg[out++] = start[i];
+        if (unescape && '%' == start[i] && i + 1 < len && '%' == start[i + 1]) i++;
+    }
+    seg[out] = '\0';
+
+    return seg;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the segments of a format
+ * @param rb_log_fmt_t* f     Format
+ */
+static void rb_log_fmt_free(rb_log_fmt_t *f)
+{
+    for (uint32_t i = 0; i <= RB_LOG_MAX_ARGS; i++) {
+        free(f->segs[i]);
+        f->segs[i] = NULL;
+    }
+}
+
+rb_logger_t *rb_log_alloc_init(int fd)
+{
+    rb_logger_t *lg;
+
+    if (fd < 0) return NULL;
+
+    lg = calloc(1, sizeof(rb_logger_t));
+    if (NULL == lg) {
+        perror("Can not allocate memory: ");
+        return NULL;
+    }
+
+    lg->out = malloc(RB_LOG_OUT_BUF);
+    if (NULL == lg->out) {
+        perror("Can not allocate memory: ");
+        free(lg);
+        return NULL;
+    }
+
+    lg->fd = fd;
+    pthread_mutex_init(&lg->lock, NULL);
+
+    return lg;
+}
+
+void rb_log_destroy(rb_logger_t *lg)
+{
+    if (!lg) return;
+
+    rb_log_stop(lg);
+
+    for (uint32_t i = 0; i < lg->num_fmts; i++) {
+        rb_log_fmt_free(&lg->fmts[i]);
+    }
+
+    for (uint32_t i = 0; i < lg->num_threads; i++) {
+        rb_ev_destroy(lg->threads[i]->ring);
+        free(lg->threads[i]);
+    }
+
+    pthread_mutex_destroy(&lg->lock);
+    free(lg->out);
+    free(lg);
+}
+
+int rb_log_register(rb_logger_t *lg, const char *fmt)
+{
+    if (!lg || !fmt || lg->running) return RB_PARAM_ERROR;
+    if (lg->num_fmts == RB_LOG_MAX_FORMATS) return RB_FULL;
+
+    rb_log_fmt_t *f = &lg->fmts[lg->num_fmts];
+    const char *seg = fmt;
+    const char *p = fmt;
+    int rc = RB_PARAM_ERROR;
+
+    memset(f, 0, sizeof(rb_log_fmt_t));
+
+    while (*p) {
+        if ('%' != *p) {
+            p++;
+            continue;
+        }
+
+        if ('%' == p[1]) {
+            p += 2;
+            continue;
+        }
+
+        /* Flags, width, precision */
+        const char *spec = p + 1;
+        spec += strspn(spec, "-+ #0'");
+        spec += strspn(spec, "0123456789");
+        if ('.' == *spec) {
+            spec++;
+            spec += strspn(spec, "0123456789");
+        }
+
+        /* Length modifier */
+        int type = RB_LOG_ARG_INT;
+        int modified = 1;
+        if ('h' == spec[0]) {
+            spec += ('h' == spec[1]) ? 2 : 1;
+        } else if ('l' == spec[0] && 'l' == spec[1]) {
+            type = RB_LOG_ARG_LLONG;
+            spec += 2;
+        } else if ('l' == spec[0]) {
+            type = RB_LOG_ARG_LONG;
+            spec++;
+        } else if ('z' == spec[0]) {
+            type = RB_LOG_ARG_SIZE;
+            spec++;
+        } else if ('j' == spec[0]) {
+            type = RB_LOG_ARG_INTMAX;
+            spec++;
+        } else if ('t' == spec[0]) {
+            type = RB_LOG_ARG_PTRDIFF;
+            spec++;
+        } else {
+            modified = 0;
+        }
+
+        /* Conversion */
+        switch (*spec) {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+            break;
+        case 'c':
+            if (modified) goto err;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            if (modified && RB_LOG_ARG_LONG != type) goto err;
+            type = RB_LOG_ARG_DOUBLE;
+            break;
+        case 's':
+            if (modified) goto err;
+            type = RB_LOG_ARG_STR;
+            break;
+        case 'p':
+            if (modified) goto err;
+            type = RB_LOG_ARG_PTR;
+            break;
+        default:
+            goto err; // '*', %n, long double and unknown conversions
+        }
+
+        if (f->num_args == RB_LOG_MAX_ARGS) goto err;
+
+        p = spec + 1;
+        f->segs[f->num_args] = rb_log_seg_dup(seg, p - seg, 0);
+        if (NULL == f->segs[f->num_args]) {
+            rc = RB_MEMORY_FAIL;
+            goto err;
+        }
+        f->types[f->num_args++] = type;
+        seg = p;
+    }
+
+    f->segs[f->num_args] = rb_log_seg_dup(seg, p - seg, 1);
+    if (NULL == f->segs[f->num_args]) {
+        rc = RB_MEMORY_FAIL;
+        goto err;
+    }
+
+    /* What every argument must leave free for the arguments after it */
+    size_t reserve = 0;
+    for (uint32_t i = f->num_args; i > 0; i--) {
+        f->reserve[i - 1] = reserve;
+        reserve += rb_log_arg_size[f->types[i - 1]];
+    }
+    if (reserve > sizeof(((rb_log_rec_t *)0)->args)) goto err;
+
+    return lg->num_fmts++;
+
+err:
+    rb_log_fmt_free(f);
+    return rc;
+}
+
+rb_log_thread_t *rb_log_attach(rb_logger_t *lg, size_t num_cells)
+{
+    rb_log_thread_t *t;
+
+    if (!lg) return NULL;
+
+    t = calloc(1, sizeof(rb_log_thread_t));
+    if (NULL == t) {
+        perror("Can not allocate memory: ");
+        return NULL;
+    }
+
+    t->logger = lg;
+    t->ring = rb_ev_alloc_init(num_cells, sizeof(rb_log_rec_t), num_cells * RB_LOG_RECORD_SIZE + 4096, NULL, NULL);
+    if (NULL == t->ring) {
+        free(t);
+        return NULL;
+    }
+
+    pthread_mutex_lock(&lg->lock);
+    if (lg->num_threads == RB_LOG_MAX_THREADS) {
+        pthread_mutex_unlock(&lg->lock);
+        rb_ev_destroy(t->ring);
+        free(t);
+        return NULL;
+    }
+    lg->threads[lg->num_threads] = t;
+    atomic_store_explicit(&lg->num_threads, lg->num_threads + 1, memory_order_release);
+    pthread_mutex_unlock(&lg->lock);
+
+    return t;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Count a dropped record
+ * @param rb_log_thread_t* t     Producer handle
+ */
+static inline void rb_log_drop(rb_log_thread_t *t)
+{
+    atomic_store_explicit(&t->dropped, t->dropped + 1, memory_order_relaxed);
+}
+
+/* Copy one argument into the record, give up if it does not fit */
+#define RB_LOG_PUT(rec, off, v) do {                                \
+        if ((off) + sizeof(v) > sizeof((rec)->args)) goto too_long; \
+        memcpy((rec)->args + (off), &(v), sizeof(v));               \
+        (off) += sizeof(v);                                         \
+    } while (0)
+
+__attribute__((hot))
+int rb_log(rb_log_thread_t *t, uint32_t fmt_id, ...)
+{
+    void *event;
+    struct timespec ts;
+    va_list ap;
+    size_t off = 0;
+
+    if (!t) return RB_PARAM_ERROR;
+
+    if (fmt_id >= t->logger->num_fmts) {
+        rb_log_drop(t);
+        return RB_PARAM_ERROR;
+    }
+
+    if (RB_OK != rb_ev_claim(t->ring, &event)) {
+        rb_log_drop(t);
+        return RB_FULL;
+    }
+
+    rb_log_rec_t *rec = event;
+    const rb_log_fmt_t *f = &t->logger->fmts[fmt_id];
+
+    va_start(ap, fmt_id);
+    for (uint32_t i = 0; i < f->num_args; i++) {
+        switch (f->types[i]) {
+        case RB_LOG_ARG_INT: {
+            int v = va_arg(ap, int);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_LONG: {
+            long v = va_arg(ap, long);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_LLONG: {
+            long long v = va_arg(ap, long long);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_SIZE: {
+            size_t v = va_arg(ap, size_t);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_INTMAX: {
+            intmax_t v = va_arg(ap, intmax_t);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_PTRDIFF: {
+            ptrdiff_t v = va_arg(ap, ptrdiff_t);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_DOUBLE: {
+            double v = va_arg(ap, double);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_PTR: {
+            void *v = va_arg(ap, void *);
+            RB_LOG_PUT(rec, off, v);
+            break;
+        }
+        case RB_LOG_ARG_STR: {
+            const char *s = va_arg(ap, const char *);
+            size_t room = sizeof(rec->args) - off - f->reserve[i];
+
+            if (NULL == s) s = "(null)";
+
+            size_t len = strnlen(s, room - 1);
+            memcpy(rec->args + off, s, len);
+            rec->args[off + len] = '\0';
+            off += len + 1;
+            break;
+        }
+        }
+    }
+    va_end(ap);
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    rec->ts_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    rec->fmt_id = fmt_id;
+    rec->len = off;
+
+    rb_ev_publish(t->ring);
+    return RB_OK;
+
+too_long:
+    va_end(ap);
+    rb_log_drop(t);
+    return RB_PARAM_ERROR;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Format one record as a text line
+ * @param rb_logger_t* lg    Logger
+ * @param const rb_log_rec_t* rec   Record
+ * @param char* buf   Output, at least RB_LOG_LINE_MAX bytes
+ * @return size_t Length of the line, including the new line character
+ */
+static size_t rb_log_format(rb_logger_t *lg, const rb_log_rec_t *rec, char *buf)
+{
+    const rb_log_fmt_t *f = &lg->fmts[rec->fmt_id];
+    const size_t room = RB_LOG_LINE_MAX - 1; // The last byte is for the new line
+    const uint8_t *arg = rec->args;
+    size_t len;
+    int n;
+
+    n = snprintf(buf, room, "%lu.%09lu ", (unsigned long)(rec->ts_ns / 1000000000ULL),
+                 (unsigned long)(rec->ts_ns % 1000000000ULL));
+    len = n > 0 ? (size_t)n : 0;
+
+    /* Every segment is the literal text before a conversion and the conversion, with exactly one argument */
+    for (uint32_t i = 0; i < f->num_args && len < room; i++) {
+        char *out = buf + len;
+        size_t out_room = room - len;
+
+/* Take one argument of the record */
+#define RB_LOG_GET(type, var) type var; memcpy(&var, arg, sizeof(type)); arg += sizeof(type)
+        switch (f->types[i]) {
+        case RB_LOG_ARG_INT: {
+            RB_LOG_GET(int, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_LONG: {
+            RB_LOG_GET(long, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_LLONG: {
+            RB_LOG_GET(long long, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_SIZE: {
+            RB_LOG_GET(size_t, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_INTMAX: {
+            RB_LOG_GET(intmax_t, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_PTRDIFF: {
+            RB_LOG_GET(ptrdiff_t, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_DOUBLE: {
+            RB_LOG_GET(double, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_PTR: {
+            RB_LOG_GET(void *, v);
+            n = snprintf(out, out_room, f->segs[i], v);
+            break;
+        }
+        case RB_LOG_ARG_STR:
+            n = snprintf(out, out_room, f->segs[i], (const char *)arg);
+            arg += strlen((const char *)arg) + 1;
+            break;
+        default:
+            n = 0;
+        }
+#undef RB_LOG_GET
+
+        if (n > 0) len += (size_t)n < out_room ? (size_t)n : out_room - 1;
+    }
+
+    /* The trailing literal text */
+    if (len < room) {
+        size_t tail = strlen(f->segs[f->num_args]);
+        if (tail > room - len - 1) tail = room - len - 1;
+        memcpy(buf + len, f->segs[f->num_args], tail);
+        len += tail;
+    }
+
+    buf[len++] = '\n';
+    return len;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write the output batch buffer
+ * @param rb_logger_t* lg    Logger
+ */
+static void rb_log_flush(rb_logger_t *lg)
+{
+    size_t done = 0;
+
+    while (done < lg->out_len) {
+        ssize_t n = write(lg->fd, lg->out + done, lg->out_len - done);
+
+        if (n < 0 && EINTR == errno) continue;
+        if (n <= 0) {
+            atomic_store_explicit(&lg->write_errors, lg->write_errors + 1, memory_order_relaxed);
+            break;
+        }
+        done += n;
+    }
+
+    atomic_store_explicit(&lg->bytes, lg->bytes + done, memory_order_relaxed);
+    lg->out_len = 0;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Background thread: format the records of all the threads, write them in batches
+ * @param void* arg   Logger
+ * @return void* Ignored
+ */
+static void *rb_log_main(void *arg)
+{
+    rb_logger_t *lg = arg;
+    struct timespec nap = { .tv_sec = 0, .tv_nsec = RB_LOG_IDLE_NS };
+
+    for (;;) {
+        int stop = atomic_load_explicit(&lg->stop, memory_order_acquire);
+        uint32_t num_threads = atomic_load_explicit(&lg->num_threads, memory_order_acquire);
+        uint64_t handled = 0;
+
+        for (uint32_t i = 0; i < num_threads; i++) {
+            rb_ev_t *ring = lg->threads[i]->ring;
+            void *event;
+
+            /* At most one ring worth of records, so a busy thread does not starve the others */
+            for (uint64_t n = 0; n < ring->capacity && RB_OK == rb_ev_peek(ring, &event); n++) {
+                if (lg->out_len + RB_LOG_LINE_MAX > RB_LOG_OUT_BUF) rb_log_flush(lg);
+                lg->out_len += rb_log_format(lg, event, lg->out + lg->out_len);
+                rb_ev_release(ring);
+                handled++;
+            }
+        }
+
+        if (handled) {
+            atomic_store_explicit(&lg->records, lg->records + handled, memory_order_relaxed);
+            continue;
+        }
+
+        /* Nothing new: write out what is buffered, exit if asked, otherwise wait */
+        rb_log_flush(lg);
+        if (stop) break;
+        nanosleep(&nap, NULL);
+    }
+
+    return NULL;
+}
+
+int rb_log_start(rb_logger_t *lg)
+{
+    if (!lg || lg->running) return RB_PARAM_ERROR;
+
+    atomic_store_explicit(&lg->stop, 0, memory_order_relaxed);
+    if (0 != pthread_create(&lg->thread, NULL, rb_log_main, lg)) {
+        perror("Can not create the logger thread: ");
+        return RB_ERROR;
+    }
+
+    lg->running = 1;
+    return RB_OK;
+}
+
+void rb_log_stop(rb_logger_t *lg)
+{
+    if (!lg || !lg->running) return;
+
+    atomic_store_explicit(&lg->stop, 1, memory_order_release);
+    pthread_join(lg->thread, NULL);
+    lg->running = 0;
+}
+
+void rb_log_get_stats(rb_logger_t *lg, uint64_t *records, uint64_t *bytes, uint64_t *dropped)
+{
+    uint64_t sum = 0;
+    uint32_t num_threads = atomic_load_explicit(&lg->num_threads, memory_order_acquire);
+
+    for (uint32_t i = 0; i < num_threads; i++) {
+        sum += atomic_load_explicit(&lg->threads[i]->dropped, memory_order_relaxed);
+    }
+
+    if (records) *records = atomic_load_explicit(&lg->records, memory_order_relaxed);
+    if (bytes) *bytes = atomic_load_explicit(&lg->bytes, memory_order_relaxed);
+    if (dropped) *dropped = sum;
+}
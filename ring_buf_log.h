@@ -0,0 +1,185 @@
+#ifndef RING_BUF_LOG_H
+#define RING_BUF_LOG_H
+
+#include "ring_buf.h"
+#include "ring_buf_ev.h"
+
+/* Size of one binary log record in the per-thread ring: the header and the raw argument bytes */
+#define RB_LOG_RECORD_SIZE 128
+/* Maximal number of conversions in one format */
+#define RB_LOG_MAX_ARGS 16
+/* Maximal number of registered formats */
+#define RB_LOG_MAX_FORMATS 1024
+/* Maximal number of producer threads */
+#define RB_LOG_MAX_THREADS 64
+/* Output batch buffer of the background thread */
+#define RB_LOG_OUT_BUF (64 * 1024)
+/* Longest formatted line; longer lines are truncated */
+#define RB_LOG_LINE_MAX 1024
+/* The background thread sleeps that long when all rings are empty */
+#define RB_LOG_IDLE_NS 100000
+
+/**
+ * @enum
+ * @brief Argument types of a registered format, taken from the conversion and its length modifier
+ */
+enum {
+    RB_LOG_ARG_INT = 0,     /**< d i u o x X c, also with hh and h: passed as int */
+    RB_LOG_ARG_LONG,        /**< l */
+    RB_LOG_ARG_LLONG,       /**< ll */
+    RB_LOG_ARG_SIZE,        /**< z */
+    RB_LOG_ARG_INTMAX,      /**< j */
+    RB_LOG_ARG_PTRDIFF,     /**< t */
+    RB_LOG_ARG_DOUBLE,      /**< f F e E g G a A */
+    RB_LOG_ARG_PTR,         /**< p */
+    RB_LOG_ARG_STR,         /**< s: the string is copied into the record, truncated to the free room */
+    RB_LOG_ARG_NUM          /**< Number of types */
+};
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Static metadata of a registered format, parsed once by rb_log_register()
+ * @details The format is split into segments: segs[i] is the literal text before conversion i plus the
+ *          conversion itself, so the background thread formats it with one snprintf() and one argument.
+ *          segs[num_args] is the trailing literal text, already unescaped. A string is truncated so the
+ *          arguments after it (reserve[i]) still fit into the record.
+ */
+typedef struct {
+    uint32_t num_args;                  /**< Number of conversions */
+    uint8_t types[RB_LOG_MAX_ARGS];     /**< RB_LOG_ARG_* of every conversion */
+    uint16_t reserve[RB_LOG_MAX_ARGS];  /**< Record bytes needed by the arguments after conversion i */
+    char *segs[RB_LOG_MAX_ARGS + 1];    /**< Format segments */
+} rb_log_fmt_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One binary log record: the format id and the raw arguments, filled in place in the ring
+ */
+typedef struct {
+    uint64_t ts_ns;          /**< CLOCK_REALTIME of the call */
+    uint32_t fmt_id;         /**< Registered format */
+    uint32_t len;            /**< Bytes used in args */
+    uint8_t args[RB_LOG_RECORD_SIZE - 16]; /**< Raw argument bytes, packed in the order of the conversions */
+} rb_log_rec_t;
+
+struct rb_logger_struct;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer handle of one thread: its own SPSC record ring
+ */
+typedef struct {
+    struct rb_logger_struct *logger; /**< Owner */
+    rb_ev_t *ring;           /**< Ring of preallocated records */
+    uint64_t dropped;        /**< Records dropped: the ring was full or the format id was invalid */
+} rb_log_thread_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Asynchronous binary logger
+ * @details The hot thread does not format anything: rb_log() copies the format id and the raw argument bytes
+ *          into a preallocated record of its own ring. The background thread takes the records of all the
+ *          threads, formats them with the static format metadata and writes the text in large batches with
+ *          write(). The order of the records is kept per thread, not across threads; every line starts with
+ *          the time of the call. Formats are registered at startup, before rb_log_start().
+ */
+typedef struct rb_logger_struct {
+    int fd;                  /**< Output file descriptor, owned by the caller */
+    uint32_t num_fmts;       /**< Number of registered formats */
+    rb_log_fmt_t fmts[RB_LOG_MAX_FORMATS]; /**< Registered formats */
+
+    pthread_mutex_t lock;    /**< Serializes rb_log_attach() */
+    uint32_t num_threads;    /**< Number of attached producer threads, published with release */
+    rb_log_thread_t *threads[RB_LOG_MAX_THREADS]; /**< Attached producer threads */
+
+    pthread_t thread;        /**< Background thread */
+    int running;             /**< 1 between rb_log_start() and rb_log_stop() */
+    int stop;                /**< Asks the background thread to drain and exit */
+    char *out;               /**< Output batch buffer */
+    size_t out_len;          /**< Bytes waiting in the output batch buffer */
+    uint64_t records;        /**< Statistics: records written */
+    uint64_t bytes;          /**< Statistics: bytes written */
+    uint64_t write_errors;   /**< Statistics: failed write() calls */
+} rb_logger_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the logger
+ * @param int fd    Output file descriptor; not closed by the logger
+ * @return rb_logger_t* Allocated logger; NULL on error
+ */
+rb_logger_t *rb_log_alloc_init(int fd);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Stop the logger if it runs, then release it and all the thread rings
+ * @param rb_logger_t* lg    Logger
+ */
+void rb_log_destroy(rb_logger_t *lg);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Register a format, before rb_log_start()
+ * @param rb_logger_t* lg    Logger
+ * @param const char* fmt   printf() format; must stay valid, supports flags, width, precision and the length
+ *        modifiers hh h l ll z j t; '*', %n and long double are not supported
+ * @return int Format id (>= 0) to pass to rb_log(), RB_PARAM_ERROR if the format is not supported or its
+ *         arguments can not fit into one record, RB_FULL if too many formats are registered, RB_MEMORY_FAIL on
+ *         allocation failure
+ */
+int rb_log_register(rb_logger_t *lg, const char *fmt);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Create the record ring of the calling thread
+ * @param rb_logger_t* lg    Logger
+ * @param size_t num_cells  Number of records in the ring, power of 2
+ * @return rb_log_thread_t* Producer handle, used by this thread only; released by rb_log_destroy(). NULL on
+ *         error or if RB_LOG_MAX_THREADS threads are attached.
+ */
+rb_log_thread_t *rb_log_attach(rb_logger_t *lg, size_t num_cells);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Start the background thread
+ * @param rb_logger_t* lg    Logger
+ * @return int RB_OK on success, RB_ERROR if the thread could not be created, RB_PARAM_ERROR if it runs
+ */
+int rb_log_start(rb_logger_t *lg);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Stop the background thread after it wrote everything logged before
+ * @param rb_logger_t* lg    Logger
+ */
+void rb_log_stop(rb_logger_t *lg);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Log a record (hot path, producer thread)
+ * @param rb_log_thread_t* t     Handle of the calling thread
+ * @param uint32_t fmt_id Format id returned by rb_log_register()
+ * @param ... Arguments of the format
+ * @return int RB_OK if logged, RB_FULL if the ring is full, RB_PARAM_ERROR if the format id is invalid; the
+ *         record is dropped and counted in both error cases
+ * @details No formatting and no system call: the raw arguments are copied into the ring. Strings are copied
+ *          too, truncated to the free room of the record.
+ */
+__attribute__((hot))
+int rb_log(rb_log_thread_t *t, uint32_t fmt_id, ...);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the logger statistics
+ * @param rb_logger_t* lg    Logger
+ * @param uint64_t* records Output: records written
+ * @param uint64_t* bytes   Output: bytes written
+ * @param uint64_t* dropped Output: records dropped by all the threads
+ */
+void rb_log_get_stats(rb_logger_t *lg, uint64_t *records, uint64_t *bytes, uint64_t *dropped);
+
+#endif // RING_BUF_LOG_H
@@ -0,0 +1,267 @@
+#define _GNU_SOURCE  // Enables MAP_ANONYMOUS, MAP_POPULATE, MADV_FREE and mincore()
+
+/**
+ * This file implements the Ring Buffer memory initialization modes and idle memory release.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <pthread.h>
+#include "ring_buf_mem.h"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release whole pages of the byte range [start, end) inside the Ring Buffer cells
+ * @param char* start  First byte
+ * @param char* end   Byte after the last one
+ * @param int use_madv_free 1 to use MADV_FREE, 0 to use MADV_DONTNEED
+ * @return ssize_t Number of released bytes, -1 on error
+ */
+static ssize_t rb_release_range(char *start, char *end, int use_madv_free)
+{
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t from = ((uintptr_t)start + page - 1) & ~(page - 1);
+    uintptr_t to = (uintptr_t)end & ~(page - 1);
+    int advice = MADV_DONTNEED;
+
+    if (to <= from) return 0;
+
+#ifdef MADV_FREE
+    if (use_madv_free) advice = MADV_FREE;
+#else
+    (void)use_madv_free;
+#endif
+
+    if (madvise((void *)from, to - from, advice) != 0) {
+        perror("madvise() failed: ");
+        return -1;
+    }
+
+    return to - from;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pre-fault thread argument: a page aligned slice of the mapping
+ */
+typedef struct {
+    char *start;             /**< First byte of the slice */
+    size_t len;              /**< Length of the slice */
+    size_t page;             /**< Page size */
+} rb_prefault_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write one byte on every page of the slice, so the kernel commits it
+ * @param void* arg   rb_prefault_t* slice
+ * @return void* Ignored
+ */
+static void *rb_prefault(void *arg)
+{
+    rb_prefault_t *pf = arg;
+
+    for (size_t off = 0; off < pf->len; off += pf->page) {
+        ((volatile char *)pf->start)[off] = 0;
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pre-fault the mapping using several threads
+ * @param char* mem   Mapping start, page aligned
+ * @param size_t len   Mapping length
+ * @details The number of threads is limited by the online CPUs and by RB_INIT_PARALLEL_CHUNK. If a thread can
+ *          not be created, the caller pre-faults its slice itself.
+ */
+static void rb_prefault_parallel(char *mem, size_t len)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t num_threads = len / RB_INIT_PARALLEL_CHUNK;
+
+    if (num_cpus > 0 && num_threads > (size_t)num_cpus) num_threads = num_cpus;
+    if (num_threads < 1) num_threads = 1;
+
+    pthread_t threads[num_threads];
+    rb_prefault_t slices[num_threads];
+    int started[num_threads];
+    size_t slice = ((len / num_threads) + page - 1) & ~(page - 1);
+
+    for (size_t i = 0; i < num_threads; i++) {
+        size_t off = i * slice;
+        slices[i].start = mem + off;
+        slices[i].len = off >= len ? 0 : (len - off < slice ? len - off : slice);
+        slices[i].page = page;
+        started[i] = (i > 0 && 0 == pthread_create(&threads[i], NULL, rb_prefault, &slices[i]));
+    }
+
+    /* The calling thread takes the first slice, and the slices of threads which could not start */
+    for (size_t i = 0; i < num_threads; i++) {
+        if (!started[i]) rb_prefault(&slices[i]);
+    }
+
+    for (size_t i = 0; i < num_threads; i++) {
+        if (started[i]) pthread_join(threads[i], NULL);
+    }
+}
+
+ring_buf_t *rb_alloc_init_lazy(size_t num_cells, size_t max_alloc_size)
+{
+    return rb_alloc_init_mode(num_cells, max_alloc_size, RB_INIT_LAZY);
+}
+
+ring_buf_t *rb_alloc_init_mode(size_t num_cells, size_t max_alloc_size, int mode)
+{
+    size_t total_memory;
+    ring_buf_t *d;
+    int map_flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    total_memory = rb_mem_size(num_cells);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+#ifndef MADV_POPULATE_WRITE
+    if (RB_INIT_POPULATE == (mode & RB_INIT_MODE_MASK)) map_flags |= MAP_POPULATE;
+#endif
+
+    /* Anonymous pages are zero-filled and committed on the first touch */
+    d = mmap(NULL, total_memory, PROT_READ | PROT_WRITE, map_flags, -1, 0);
+    if (MAP_FAILED == d) {
+        perror("Can not map memory: ");
+        return NULL;
+    }
+
+    switch (mode & RB_INIT_MODE_MASK) {
+    case RB_INIT_TOUCH:
+        rb_prefault(&(rb_prefault_t){ .start = (char *)d, .len = total_memory,
+                                      .page = (size_t)sysconf(_SC_PAGESIZE) });
+        break;
+    case RB_INIT_POPULATE:
+#ifdef MADV_POPULATE_WRITE
+        /* Not supported before Linux 5.14: fall back to touching the pages */
+        if (madvise(d, total_memory, MADV_POPULATE_WRITE) != 0) {
+            rb_prefault(&(rb_prefault_t){ .start = (char *)d, .len = total_memory,
+                                          .page = (size_t)sysconf(_SC_PAGESIZE) });
+        }
+#endif
+        break;
+    case RB_INIT_PARALLEL:
+        rb_prefault_parallel((char *)d, total_memory);
+        break;
+    case RB_INIT_LAZY:
+        break;
+    default:
+        munmap(d, total_memory);
+        return NULL;
+    }
+
+    if ((mode & RB_INIT_MLOCK) && mlock(d, total_memory) != 0) {
+        perror("mlock() failed: ");
+        munmap(d, total_memory);
+        return NULL;
+    }
+
+    d->capacity = num_cells;
+    d->max_alloc_size = max_alloc_size;
+    d->flags = RB_ALLOC_MMAP;
+    atomic_init(&d->head, 0);
+    atomic_init(&d->tail, 0);
+
+    return d;
+}
+
+void rb_idle_init(rb_idle_t *p, uint64_t idle_ns, uint64_t low_cells, uint64_t guard_cells)
+{
+    memset(p, 0, sizeof(rb_idle_t));
+    p->idle_ns = idle_ns;
+    p->low_cells = low_cells;
+    p->guard_cells = guard_cells;
+}
+
+int rb_release_idle(ring_buf_t *d, rb_idle_t *p, uint64_t now_ns)
+{
+    if (!d || !p || !(d->flags & RB_ALLOC_MMAP)) return RB_PARAM_ERROR;
+
+    uint64_t tail = atomic_load_explicit(&d->tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&d->head, memory_order_acquire);
+
+    if (tail - head > p->low_cells) {
+        p->low_since_ns = 0;
+        return RB_EMPTY;
+    }
+
+    if (0 == p->low_since_ns) {
+        p->low_since_ns = now_ns;
+        return RB_EMPTY;
+    }
+
+    if (now_ns - p->low_since_ns < p->idle_ns) return RB_EMPTY;
+
+    /* Restart the idle period, so the same pages are not released on every call */
+    p->low_since_ns = now_ns;
+
+    /* Free cells are [tail, head + capacity - 1); keep the guard after tail */
+    uint64_t from = tail + p->guard_cells;
+    uint64_t to = head + d->capacity - 1;
+    if (from >= to) return RB_EMPTY;
+
+    uint64_t mask = d->capacity - 1;
+    char *start = (char *)&d->cells[from & mask];
+    ssize_t released = 0;
+    ssize_t rc;
+
+    if ((from & mask) < (to & mask)) {
+        released = rb_release_range(start, (char *)&d->cells[to & mask], p->use_madv_free);
+    } else {
+        /* The free window wraps around the end of the cells array */
+        released = rb_release_range(start, (char *)&d->cells[d->capacity], p->use_madv_free);
+        rc = rb_release_range((char *)&d->cells[0], (char *)&d->cells[to & mask], p->use_madv_free);
+        released = (released < 0 || rc < 0) ? -1 : released + rc;
+    }
+
+    if (released < 0) return RB_ERROR;
+    if (0 == released) return RB_EMPTY;
+
+    p->released_bytes += released;
+    return RB_OK;
+}
+
+int rb_mem_usage(ring_buf_t *d, size_t *resident, size_t *reserved)
+{
+    if (!d || !resident || !reserved) return RB_PARAM_ERROR;
+
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t)d & ~(page - 1);
+    uintptr_t end = (uintptr_t)d + rb_mem_size(d->capacity);
+    size_t pages = (end - start + page - 1) / page;
+    unsigned char *vec = malloc(pages);
+
+    if (NULL == vec) return RB_MEMORY_FAIL;
+
+    if (mincore((void *)start, end - start, vec) != 0) {
+        perror("mincore() failed: ");
+        free(vec);
+        return RB_ERROR;
+    }
+
+    size_t in_core = 0;
+    for (size_t i = 0; i < pages; i++) {
+        if (vec[i] & 1) in_core++;
+    }
+    free(vec);
+
+    *reserved = rb_mem_size(d->capacity);
+    *resident = in_core * page;
+    if (*resident > *reserved) *resident = *reserved;
+    return RB_OK;
+}
@@ -0,0 +1,95 @@
+#ifndef RING_BUF_MEM_H
+#define RING_BUF_MEM_H
+
+#include "ring_buf.h"
+
+/**
+ * @enum
+ * @brief Initialization modes of rb_alloc_init_mode(); one mode can be combined with RB_INIT_MLOCK
+ */
+enum {
+    RB_INIT_TOUCH = 0,          /**< Write every page once on the calling thread */
+    RB_INIT_LAZY = 1,           /**< Touch nothing, pages are committed as the producer reaches them */
+    RB_INIT_POPULATE = 2,       /**< Let the kernel pre-fault: MADV_POPULATE_WRITE, or MAP_POPULATE */
+    RB_INIT_PARALLEL = 3,       /**< Write every page once, split between several threads */
+    RB_INIT_MODE_MASK = 0xff,   /**< Mask of the mode bits */
+    RB_INIT_MLOCK = 1 << 8,     /**< Pin the pages with mlock(); implies pre-faulting */
+};
+
+/* RB_INIT_PARALLEL: every thread pre-faults at least this many bytes */
+#define RB_INIT_PARALLEL_CHUNK (16UL * 1024 * 1024)
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Idle memory release policy, owned by the producer, see rb_release_idle()
+ */
+typedef struct {
+    uint64_t idle_ns;        /**< How long the occupancy must stay low before memory is released */
+    uint64_t low_cells;      /**< Occupancy (in cells) at or below this value is considered low */
+    uint64_t guard_cells;    /**< Free cells right after the producer index which are never released */
+    int use_madv_free;       /**< 1: release with MADV_FREE, 0: release with MADV_DONTNEED */
+    uint64_t low_since_ns;   /**< Internal: when the occupancy became low, 0 if it is not low */
+    uint64_t released_bytes; /**< Statistics: total bytes given back to the kernel */
+} rb_idle_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the Ring Buffer without touching the cells
+ * @param size_t num_cells     How many records should be in the Ring Buffer, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to reserve
+ * @return ring_buf_t* Allocated and inited Ring Buffer structure; NULL on error
+ * @details The memory is an anonymous mapping: only the reserve is taken, and the pages are committed by the
+ *          kernel as the producer reaches them. Release it with rb_destroy() as usual.
+ */
+ring_buf_t *rb_alloc_init_lazy(size_t num_cells, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the Ring Buffer with the given initialization mode
+ * @param size_t num_cells     How many records should be in the Ring Buffer, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @param int mode          One of RB_INIT_TOUCH, RB_INIT_LAZY, RB_INIT_POPULATE, RB_INIT_PARALLEL, optionally
+ *        or-ed with RB_INIT_MLOCK
+ * @return ring_buf_t* Allocated and inited Ring Buffer structure; NULL on error, also if mlock() failed
+ * @details The memory is always an anonymous mapping, so the pages are touched at most once (fresh pages are
+ *          already zeroed), and rb_destroy() unmaps (and so unlocks) it.
+ */
+ring_buf_t *rb_alloc_init_mode(size_t num_cells, size_t max_alloc_size, int mode);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Init the idle memory release policy
+ * @param rb_idle_t* p     Policy to init
+ * @param uint64_t idle_ns How long the occupancy must stay low before memory is released
+ * @param uint64_t low_cells Occupancy (in cells) at or below this value is considered low
+ * @param uint64_t guard_cells Free cells after the producer index which are never released
+ */
+void rb_idle_init(rb_idle_t *p, uint64_t idle_ns, uint64_t low_cells, uint64_t guard_cells);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Give back the pages of free cells if the occupancy stayed low long enough (producer side)
+ * @param ring_buf_t* d     Ring Buffer allocated with rb_alloc_init_lazy()
+ * @param rb_idle_t* p     Idle release policy
+ * @param uint64_t now_ns  Current CLOCK_MONOTONIC time, nanoseconds
+ * @return int RB_OK if memory was released, RB_EMPTY if there was nothing to release yet, RB_PARAM_ERROR if
+ *         the Ring Buffer is not an anonymous mapping, RB_ERROR if madvise() failed
+ * @details Must be called by the producer: only the producer writes into free cells, so their pages can be
+ *          dropped without a race. Only the pages entirely inside the free window (after the guard) are
+ *          released; the consumer never reads there until the producer wrote them again.
+ */
+int rb_release_idle(ring_buf_t *d, rb_idle_t *p, uint64_t now_ns);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Report resident and reserved memory of a Ring Buffer
+ * @param ring_buf_t* d     Ring Buffer
+ * @param size_t* resident Output: bytes backed by physical memory
+ * @param size_t* reserved Output: bytes of address space the Ring Buffer occupies
+ * @return int RB_OK on success, RB_PARAM_ERROR on invalid input, RB_MEMORY_FAIL if the page vector could not
+ *         be allocated, RB_ERROR if mincore() failed
+ */
+int rb_mem_usage(ring_buf_t *d, size_t *resident, size_t *reserved);
+
+#endif // RING_BUF_MEM_H
@@ -0,0 +1,177 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a K-way timestamp merge consumer over several pointer rings.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_merge.h"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Default timestamp extractor: the payload starts with a uint64_t timestamp
+ */
+static uint64_t rb_merge_ts_default(void *data, size_t size, __attribute__((unused))void *ctx)
+{
+    uint64_t ts = 0;
+
+    if (data && size >= sizeof(ts)) memcpy(&ts, data, sizeof(ts));
+    return ts;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Compare the next records of two inputs
+ * @return int Non zero if input a goes before input b
+ */
+static inline int rb_merge_less(rb_merge_t *m, uint32_t a, uint32_t b)
+{
+    uint64_t ta = m->inputs[a].ts[m->inputs[a].pos];
+    uint64_t tb = m->inputs[b].ts[m->inputs[b].pos];
+
+    return ta < tb || (ta == tb && a < b);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Move the heap element at position i down to its place
+ */
+static void rb_merge_sift_down(rb_merge_t *m, size_t i)
+{
+    for (;;) {
+        size_t l = 2 * i + 1, r = l + 1, min = i;
+
+        if (l < m->heap_len && rb_merge_less(m, m->heap[l], m->heap[min])) min = l;
+        if (r < m->heap_len && rb_merge_less(m, m->heap[r], m->heap[min])) min = r;
+        if (min == i) return;
+
+        uint32_t tmp = m->heap[i];
+        m->heap[i] = m->heap[min];
+        m->heap[min] = tmp;
+        i = min;
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Insert an input into the heap
+ */
+static void rb_merge_heap_push(rb_merge_t *m, uint32_t in)
+{
+    size_t i = m->heap_len++;
+
+    m->heap[i] = in;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!rb_merge_less(m, m->heap[i], m->heap[parent])) return;
+
+        uint32_t tmp = m->heap[i];
+        m->heap[i] = m->heap[parent];
+        m->heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Try to pull a batch into every input without buffered records
+ */
+static void rb_merge_refill(rb_merge_t *m)
+{
+    for (size_t i = 0; i < m->num_idle;) {
+        uint32_t in = m->idle[i];
+        rb_merge_in_t *input = &m->inputs[in];
+        size_t pulled = 0;
+
+        if (RB_OK != rb_pull_ptr_batch(input->ring, input->data, input->sizes, RB_MERGE_BATCH, &pulled)) {
+            i++;
+            continue;
+        }
+
+        for (size_t n = 0; n < pulled; n++) {
+            input->ts[n] = m->ts_fn(input->data[n], input->sizes[n], m->ts_ctx);
+        }
+        input->pos = 0;
+        input->count = pulled;
+
+        m->idle[i] = m->idle[--m->num_idle];
+        rb_merge_heap_push(m, in);
+    }
+}
+
+rb_merge_t *rb_merge_alloc_init(ring_buf_t **rings, size_t num_rings, rb_merge_ts_fn_t ts_fn, void *ts_ctx,
+                                int strict)
+{
+    rb_merge_t *m;
+
+    if (!rings || 0 == num_rings || num_rings > UINT32_MAX) return NULL;
+
+    m = calloc(1, sizeof(rb_merge_t));
+    if (NULL == m) return NULL;
+
+    m->num_inputs = num_rings;
+    m->ts_fn = ts_fn ? ts_fn : rb_merge_ts_default;
+    m->ts_ctx = ts_ctx;
+    m->strict = strict;
+    m->heap = calloc(num_rings, sizeof(uint32_t));
+    m->idle = calloc(num_rings, sizeof(uint32_t));
+    m->inputs = aligned_alloc(64, ((num_rings * sizeof(rb_merge_in_t)) + 63) & ~(size_t)63);
+    if (NULL == m->heap || NULL == m->idle || NULL == m->inputs) {
+        perror("Can not allocate memory: ");
+        rb_merge_destroy(m);
+        return NULL;
+    }
+
+    memset(m->inputs, 0, num_rings * sizeof(rb_merge_in_t));
+    for (size_t i = 0; i < num_rings; i++) {
+        m->inputs[i].ring = rings[i];
+        m->idle[m->num_idle++] = i;
+    }
+
+    return m;
+}
+
+void rb_merge_destroy(rb_merge_t *m)
+{
+    if (!m) return;
+
+    free(m->heap);
+    free(m->idle);
+    free(m->inputs);
+    free(m);
+}
+
+int rb_merge_pull(rb_merge_t *m, void **data, size_t *size, size_t *src)
+{
+    if (!m || !data || !size) return RB_PARAM_ERROR;
+
+    if (m->num_idle) rb_merge_refill(m);
+
+    /* An input without records could still produce an older event */
+    if (m->strict && m->num_idle) return RB_EMPTY;
+    if (0 == m->heap_len) return RB_EMPTY;
+
+    uint32_t in = m->heap[0];
+    rb_merge_in_t *input = &m->inputs[in];
+
+    *data = input->data[input->pos];
+    *size = input->sizes[input->pos];
+    if (src) *src = in;
+
+    if (++input->pos < input->count) {
+        rb_merge_sift_down(m, 0);
+        return RB_OK;
+    }
+
+    /* The batch is consumed: the input leaves the heap until the next refill */
+    m->heap[0] = m->heap[--m->heap_len];
+    if (m->heap_len) rb_merge_sift_down(m, 0);
+    m->idle[m->num_idle++] = in;
+
+    return RB_OK;
+}
@@ -0,0 +1,87 @@
+#ifndef RING_BUF_MERGE_H
+#define RING_BUF_MERGE_H
+
+#include "ring_buf.h"
+
+/* How many records are pulled from an input ring at once */
+#define RB_MERGE_BATCH 32
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Extract the timestamp embedded in a payload
+ * @param void* data  Payload pointer pulled from a ring
+ * @param size_t size  Payload size
+ * @param void* ctx   Context given to rb_merge_alloc_init()
+ * @return uint64_t The timestamp
+ */
+typedef uint64_t (*rb_merge_ts_fn_t)(void *data, size_t size, void *ctx);
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One input of the merge: its ring and the records pulled from it in the last batch
+ */
+typedef struct {
+    ring_buf_t *ring;        /**< Input pointer ring */
+    size_t pos;              /**< Next buffered record */
+    size_t count;            /**< Number of buffered records */
+    void *data[RB_MERGE_BATCH];     /**< Buffered payload pointers */
+    size_t sizes[RB_MERGE_BATCH];   /**< Buffered payload sizes */
+    uint64_t ts[RB_MERGE_BATCH];    /**< Buffered timestamps */
+} rb_merge_in_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief K-way timestamp merge consumer over N pointer rings
+ * @details Every input ring is drained in batches with rb_pull_ptr_batch(), so the ring indexes are touched
+ *          once per batch and not once per event. The inputs which have buffered records are kept in a binary
+ *          min-heap keyed by the timestamp of their next record (ties are broken by the input number), and
+ *          the merge yields the smallest one.
+ *          In strict mode the merge yields nothing while any input has no buffered record, because that input
+ *          could still produce an older event; in relaxed mode it merges whatever is available.
+ */
+typedef struct {
+    size_t num_inputs;       /**< Number of inputs */
+    rb_merge_ts_fn_t ts_fn;  /**< Timestamp extractor */
+    void *ts_ctx;            /**< Context of ts_fn */
+    int strict;              /**< 1: strict global order, 0: merge what is available */
+    size_t heap_len;         /**< Number of inputs in the heap */
+    size_t num_idle;         /**< Number of inputs without buffered records */
+    uint32_t *heap;          /**< Min-heap of input numbers */
+    uint32_t *idle;          /**< Inputs without buffered records */
+    rb_merge_in_t *inputs;   /**< Inputs */
+} rb_merge_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the merge consumer
+ * @param ring_buf_t** rings  Input pointer rings; the merge is their only consumer
+ * @param size_t num_rings  Number of rings
+ * @param rb_merge_ts_fn_t ts_fn Timestamp extractor; NULL means the payload starts with a uint64_t timestamp
+ * @param void* ts_ctx  Context of ts_fn
+ * @param int strict    1 for strict global order, 0 to merge only what is available
+ * @return rb_merge_t* Allocated and inited merge; NULL on error
+ */
+rb_merge_t *rb_merge_alloc_init(ring_buf_t **rings, size_t num_rings, rb_merge_ts_fn_t ts_fn, void *ts_ctx,
+                                int strict);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the merge consumer; the buffered records are dropped
+ * @param rb_merge_t* m     Merge to free
+ */
+void rb_merge_destroy(rb_merge_t *m);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull the next event in timestamp order
+ * @param rb_merge_t* m     Merge
+ * @param void** data  The pointer to a buffer will be copied into
+ * @param size_t* size  Size of returned buffer
+ * @param size_t* src   Optional output: number of the input ring the event came from
+ * @return int RB_OK on success, RB_EMPTY if no event can be yielded now, RB_PARAM_ERROR on invalid input
+ */
+int rb_merge_pull(rb_merge_t *m, void **data, size_t *size, size_t *src);
+
+#endif // RING_BUF_MERGE_H
@@ -0,0 +1,240 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a multi-producer ring with a Disruptor-style sequencer and an availability array.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include <sched.h>
+#include "ring_buf_mp.h"
+
+/* rb_mp_claim() spins that many times on a full ring before it starts yielding the CPU */
+#define RB_MP_CLAIM_SPINS 1024
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the availability array: one lap number per cell, placed right after the cells
+ * @param rb_mp_t* mp    Ring
+ * @return uint32_t* The availability array
+ */
+static inline uint32_t *rb_mp_avail(rb_mp_t *mp)
+{
+    return (uint32_t *)&mp->cells[mp->capacity];
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Check whether the cells of the sequences [seq, seq + n) are free, refresh the cached head if not
+ * @param rb_mp_t* mp    Ring
+ * @param uint64_t seq   First sequence
+ * @param size_t n     Number of sequences
+ * @return int 1 if the cells are free, 0 if the consumer still holds some of them
+ */
+static inline int rb_mp_has_room(rb_mp_t *mp, uint64_t seq, size_t n)
+{
+    /* Acquire: pairs with the release below, so the consumer's reads of the freed cells happen before our
+     * writes even when another producer loaded head */
+    uint64_t head = atomic_load_explicit(&mp->cached_head, memory_order_acquire);
+
+    if (seq + n <= head + mp->capacity) return 1;
+
+    head = atomic_load_explicit(&mp->head, memory_order_acquire);
+    atomic_store_explicit(&mp->cached_head, head, memory_order_release);
+
+    return seq + n <= head + mp->capacity;
+}
+
+rb_mp_t *rb_mp_alloc_init(size_t num_cells, size_t max_alloc_size)
+{
+    size_t total_memory;
+    rb_mp_t *mp;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    total_memory = sizeof(rb_mp_t) + num_cells * sizeof(cell_t) + num_cells * sizeof(uint32_t);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    mp = aligned_alloc(64, total_memory);
+    if (NULL == mp) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(mp, 0, total_memory);
+    mp->capacity = num_cells;
+    mp->max_alloc_size = max_alloc_size;
+    mp->index_shift = __builtin_ctzll(num_cells);
+
+    /* No lap matches: nothing is published yet */
+    memset(rb_mp_avail(mp), 0xFF, num_cells * sizeof(uint32_t));
+
+    return mp;
+}
+
+void rb_mp_destroy(rb_mp_t *mp)
+{
+    free(mp);
+}
+
+int rb_mp_claim(rb_mp_t *mp, size_t n, uint64_t *seq)
+{
+    if (!mp || !seq || 0 == n || n > mp->capacity) return RB_PARAM_ERROR;
+
+    uint64_t first = atomic_fetch_add_explicit(&mp->claim, n, memory_order_relaxed);
+
+    for (int spin = 0; !rb_mp_has_room(mp, first, n); spin++) {
+        if (spin < RB_MP_CLAIM_SPINS) {
+            rb_cpu_relax();
+        } else {
+            sched_yield();
+        }
+    }
+
+    *seq = first;
+    return RB_OK;
+}
+
+int rb_mp_try_claim(rb_mp_t *mp, size_t n, uint64_t *seq)
+{
+    if (!mp || !seq || 0 == n || n > mp->capacity) return RB_PARAM_ERROR;
+
+    uint64_t first = atomic_load_explicit(&mp->claim, memory_order_relaxed);
+
+    do {
+        if (!rb_mp_has_room(mp, first, n)) return RB_FULL;
+    } while (!atomic_compare_exchange_weak_explicit(&mp->claim, &first, first + n,
+                                                    memory_order_relaxed, memory_order_relaxed));
+
+    *seq = first;
+    return RB_OK;
+}
+
+void rb_mp_publish(rb_mp_t *mp, uint64_t seq, size_t n)
+{
+    uint32_t *avail = rb_mp_avail(mp);
+    uint64_t mask = mp->capacity - 1;
+
+    /* One fence orders all cell writes before all the availability stores */
+    atomic_thread_fence(memory_order_release);
+
+    for (uint64_t s = seq; s < seq + n; s++) {
+        atomic_store_explicit(&avail[s & mask], (uint32_t)(s >> mp->index_shift), memory_order_relaxed);
+    }
+}
+
+__attribute__((hot))
+int rb_mp_push_ptr(rb_mp_t *mp, void *data, size_t size)
+{
+    uint64_t seq;
+    int rc = rb_mp_try_claim(mp, 1, &seq);
+
+    if (RB_OK != rc) return rc;
+
+    cell_t *cell = rb_mp_cell(mp, seq);
+    cell->data = data;
+    cell->size = size;
+
+    rb_mp_publish(mp, seq, 1);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_mp_push_int(rb_mp_t *mp, int64_t idata)
+{
+    uint64_t seq;
+    int rc = rb_mp_try_claim(mp, 1, &seq);
+
+    if (RB_OK != rc) return rc;
+
+    rb_mp_cell(mp, seq)->idata = idata;
+
+    rb_mp_publish(mp, seq, 1);
+    return RB_OK;
+}
+
+size_t rb_mp_poll(rb_mp_t *mp, uint64_t *seq)
+{
+    uint32_t *avail = rb_mp_avail(mp);
+    uint64_t mask = mp->capacity - 1;
+    uint64_t head = atomic_load_explicit(&mp->head, memory_order_relaxed);
+    size_t count = 0;
+
+    /* A cell of a later lap holds the previous lap number until it is published, so the scan stops there */
+    while (count < mp->capacity &&
+           atomic_load_explicit(&avail[(head + count) & mask], memory_order_relaxed) ==
+           (uint32_t)((head + count) >> mp->index_shift)) {
+        count++;
+    }
+
+    atomic_thread_fence(memory_order_acquire);
+
+    *seq = head;
+    return count;
+}
+
+void rb_mp_consume(rb_mp_t *mp, size_t n)
+{
+    uint64_t head = atomic_load_explicit(&mp->head, memory_order_relaxed);
+
+    atomic_store_explicit(&mp->head, head + n, memory_order_release);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Check whether the head sequence is published
+ * @param rb_mp_t* mp    Ring
+ * @param uint64_t* head  Output: the head sequence
+ * @return int 1 if the head cell can be read, 0 if not
+ */
+static inline int rb_mp_head_ready(rb_mp_t *mp, uint64_t *head)
+{
+    uint64_t seq = atomic_load_explicit(&mp->head, memory_order_relaxed);
+
+    if (atomic_load_explicit(&rb_mp_avail(mp)[seq & (mp->capacity - 1)], memory_order_acquire) !=
+        (uint32_t)(seq >> mp->index_shift)) {
+        return 0;
+    }
+
+    *head = seq;
+    return 1;
+}
+
+__attribute__((hot))
+int rb_mp_pull_ptr(rb_mp_t *mp, void **data, size_t *size)
+{
+    uint64_t head;
+
+    if (!mp || !data || !size) return RB_PARAM_ERROR;
+    if (!rb_mp_head_ready(mp, &head)) return RB_EMPTY;
+
+    cell_t *cell = rb_mp_cell(mp, head);
+    *data = cell->data;
+    *size = cell->size;
+
+    atomic_store_explicit(&mp->head, head + 1, memory_order_release);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_mp_pull_int(rb_mp_t *mp, int64_t *idata)
+{
+    uint64_t head;
+
+    if (!mp || !idata) return RB_PARAM_ERROR;
+    if (!rb_mp_head_ready(mp, &head)) return RB_EMPTY;
+
+    *idata = rb_mp_cell(mp, head)->idata;
+
+    atomic_store_explicit(&mp->head, head + 1, memory_order_release);
+    return RB_OK;
+}
@@ -0,0 +1,143 @@
+#ifndef RING_BUF_MP_H
+#define RING_BUF_MP_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Multi-producer single-consumer ring with a Disruptor-style sequencer
+ * @details Producers claim ranges of sequences with one fetch_add on the claim counter (or a CAS in
+ *          rb_mp_try_claim()), write their cells, and publish them by storing the lap number of every sequence
+ *          (seq >> index_shift) into the availability array. The consumer does not read the claim counter: it
+ *          scans the availability array from head for the highest contiguous published sequence, so a slow
+ *          producer only delays the sequences after its own. All capacity cells are usable. The control
+ *          structure, the cells and the availability array are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t capacity;       /**< Buffer capacity (must be power of 2) */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t index_shift;    /**< log2(capacity) */
+    uint64_t claim __attribute__((aligned(64))); /**< Producers: next sequence to claim */
+    uint64_t cached_head __attribute__((aligned(64))); /**< Producers: last seen consumer position */
+    uint64_t head __attribute__((aligned(64)));  /**< Consumer read index */
+    cell_t cells[] __attribute__((aligned(64))); /**< Ring buffer data, followed by the availability array */
+} rb_mp_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the multi-producer ring
+ * @param size_t num_cells     How many records should be in the ring, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @return rb_mp_t* Allocated and inited ring; NULL on error
+ */
+rb_mp_t *rb_mp_alloc_init(size_t num_cells, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the ring
+ * @param rb_mp_t* mp    Ring to free
+ */
+void rb_mp_destroy(rb_mp_t *mp);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Claim n consecutive sequences, wait until their cells are free (any producer)
+ * @param rb_mp_t* mp    Ring
+ * @param size_t n     How many sequences to claim, 1..capacity
+ * @param uint64_t* seq   Output: the first claimed sequence
+ * @return int RB_OK on success, RB_PARAM_ERROR on invalid input
+ * @details One fetch_add, no retry loop. The claim can not be given back: the caller must publish all n
+ *          sequences. If the ring is full, the call spins, then yields, until the consumer frees the cells.
+ */
+int rb_mp_claim(rb_mp_t *mp, size_t n, uint64_t *seq);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Claim n consecutive sequences only if their cells are free now (any producer)
+ * @param rb_mp_t* mp    Ring
+ * @param size_t n     How many sequences to claim, 1..capacity
+ * @param uint64_t* seq   Output: the first claimed sequence
+ * @return int RB_OK on success, RB_FULL if there are less than n free cells, RB_PARAM_ERROR on invalid input
+ * @details A CAS loop on the claim counter
+ */
+int rb_mp_try_claim(rb_mp_t *mp, size_t n, uint64_t *seq);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the cell of a claimed or readable sequence
+ * @param rb_mp_t* mp    Ring
+ * @param uint64_t seq   Sequence
+ * @return cell_t* The cell
+ */
+static inline cell_t *rb_mp_cell(rb_mp_t *mp, uint64_t seq)
+{
+    return &mp->cells[seq & (mp->capacity - 1)];
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Publish n claimed sequences after their cells are written
+ * @param rb_mp_t* mp    Ring
+ * @param uint64_t seq   First sequence to publish
+ * @param size_t n     How many sequences to publish
+ */
+void rb_mp_publish(rb_mp_t *mp, uint64_t seq, size_t n);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a pointer and the buffer size in the ring (any producer)
+ * @param rb_mp_t* mp    Ring
+ * @param void* data  Pointer to a buffer to save
+ * @param size_t size  Size of the saved buffer
+ * @return int RB_OK if saved, RB_FULL if the ring is full, RB_PARAM_ERROR if the ring pointer is invalid
+ */
+int rb_mp_push_ptr(rb_mp_t *mp, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Push an integer value to the ring (any producer)
+ * @param rb_mp_t* mp    Ring
+ * @param int64_t idata Integer value to save
+ * @return int RB_OK if saved, RB_FULL if the ring is full, RB_PARAM_ERROR if the ring pointer is invalid
+ */
+int rb_mp_push_int(rb_mp_t *mp, int64_t idata);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Find how many sequences from head are published without a gap (consumer side)
+ * @param rb_mp_t* mp    Ring
+ * @param uint64_t* seq   Output: the first readable sequence (the head index)
+ * @return size_t Number of readable sequences; 0 if the ring is empty or the next sequence is not published yet
+ * @details The cells [seq, seq + count) can be read with rb_mp_cell(), then freed with rb_mp_consume()
+ */
+size_t rb_mp_poll(rb_mp_t *mp, uint64_t *seq);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Free n read cells, publishing head once (consumer side)
+ * @param rb_mp_t* mp    Ring
+ * @param size_t n     How many cells to free, not more than rb_mp_poll() returned
+ */
+void rb_mp_consume(rb_mp_t *mp, size_t n);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer from the ring (consumer side)
+ * @param rb_mp_t* mp    Ring
+ * @param void** data  Output: buffer pointer
+ * @param size_t* size  Output: buffer size
+ * @return int RB_OK on success, RB_EMPTY if nothing is published, RB_PARAM_ERROR on invalid input
+ */
+int rb_mp_pull_ptr(rb_mp_t *mp, void **data, size_t *size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Extract an integer value from the ring (consumer side)
+ * @param rb_mp_t* mp    Ring
+ * @param int64_t* idata Output: the value
+ * @return int RB_OK on success, RB_EMPTY if nothing is published, RB_PARAM_ERROR on invalid input
+ */
+int rb_mp_pull_int(rb_mp_t *mp, int64_t *idata);
+
+#endif // RING_BUF_MP_H
@@ -0,0 +1,103 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements an SPSC message ring which keeps small messages inline, in one cache line cells.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_msg.h"
+
+rb_msg_t *rb_msg_alloc_init(size_t num_cells, size_t max_alloc_size)
+{
+    size_t total_memory;
+    rb_msg_t *r;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    total_memory = sizeof(rb_msg_t) + num_cells * sizeof(rb_msg_cell_t);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    r = aligned_alloc(64, total_memory);
+    if (NULL == r) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(r, 0, total_memory);
+    r->capacity = num_cells;
+    r->max_alloc_size = max_alloc_size;
+
+    return r;
+}
+
+void rb_msg_destroy(rb_msg_t *r)
+{
+    free(r);
+}
+
+int rb_msg_push(rb_msg_t *r, const void *data, size_t size)
+{
+    if (!r || (!data && size) || size > UINT32_MAX) return RB_PARAM_ERROR;
+
+    uint64_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+    if (tail - r->cached_head == r->capacity) {
+        r->cached_head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (tail - r->cached_head == r->capacity) return RB_FULL; // Buffer is full
+    }
+
+    rb_msg_cell_t *cell = &r->cells[tail & (r->capacity - 1)];
+
+    cell->size = size;
+    if (size <= RB_MSG_INLINE_MAX) {
+        cell->flags = RB_MSG_INLINE;
+        memcpy(cell->inline_data, data, size);
+    } else {
+        cell->flags = 0;
+        cell->data = (void *)data;
+    }
+
+    atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_msg_peek(rb_msg_t *r, const void **data, size_t *size)
+{
+    if (!r || !data || !size) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+
+    if (head == r->cached_tail) {
+        r->cached_tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+        if (head == r->cached_tail) return RB_EMPTY; // Buffer is empty
+    }
+
+    const rb_msg_cell_t *cell = &r->cells[head & (r->capacity - 1)];
+
+    *size = cell->size;
+    *data = (cell->flags & RB_MSG_INLINE) ? (const void *)cell->inline_data : cell->data;
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_msg_release(rb_msg_t *r)
+{
+    if (!r) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    if (head == r->cached_tail) return RB_EMPTY;
+
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+    return RB_OK;
+}
@@ -0,0 +1,100 @@
+#ifndef RING_BUF_MSG_H
+#define RING_BUF_MSG_H
+
+#include "ring_buf.h"
+
+/* Messages up to this size are copied into the cell itself */
+#define RB_MSG_INLINE_MAX 56
+
+/**
+ * @enum
+ * @brief Flags of rb_msg_cell_t
+ */
+enum {
+    RB_MSG_INLINE = 1 << 0,  /**< The payload is stored in the cell, not behind a pointer */
+};
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One cache line cell: a small payload copied inline, or a pointer to a large one
+ */
+typedef struct {
+    uint32_t size;           /**< Size of the payload */
+    uint32_t flags;          /**< RB_MSG_* flags */
+    union {
+        uint8_t inline_data[RB_MSG_INLINE_MAX]; /**< Payload, if RB_MSG_INLINE */
+        void *data;          /**< Pointer to the payload otherwise */
+    };
+} __attribute__((aligned(64))) rb_msg_cell_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Lock-free SPSC message ring with inline small messages
+ * @details Messages up to RB_MSG_INLINE_MAX bytes are copied into the cell, which saves the allocation of the
+ *          message and the dereference (cache miss) on the consumer side. Larger messages fall back to a
+ *          pointer, like rb_push_ptr(). The consumer always gets a pointer and a size with rb_msg_peek(), valid
+ *          until rb_msg_release(). The control structure and the cells are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t capacity;       /**< Number of cells (power of 2) */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t tail __attribute__((aligned(64))); /**< Producer write index */
+    uint64_t cached_head;    /**< Producer: last seen consumer index */
+    uint64_t head __attribute__((aligned(64))); /**< Consumer read index */
+    uint64_t cached_tail;    /**< Consumer: last seen producer index */
+    rb_msg_cell_t cells[];   /**< Ring data, one cache line per cell */
+} rb_msg_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the message ring
+ * @param size_t num_cells     How many messages should be in the ring, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @return rb_msg_t* Allocated and inited ring; NULL on error
+ */
+rb_msg_t *rb_msg_alloc_init(size_t num_cells, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the message ring
+ * @param rb_msg_t* r     Ring to free
+ */
+void rb_msg_destroy(rb_msg_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a message in the ring (producer side)
+ * @param rb_msg_t* r     Ring
+ * @param const void* data  Message
+ * @param size_t size  Message size
+ * @return int RB_OK if saved, RB_FULL if the ring is full, RB_PARAM_ERROR on invalid input
+ * @details Up to RB_MSG_INLINE_MAX bytes the message is copied, and the caller may reuse its buffer at once.
+ *          A larger message is passed by pointer: the buffer must stay valid until the consumer released it.
+ */
+int rb_msg_push(rb_msg_t *r, const void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the next message without removing it (consumer side)
+ * @param rb_msg_t* r     Ring
+ * @param const void** data Output: the message, inline or not
+ * @param size_t* size  Output: the message size
+ * @return int RB_OK on success, RB_EMPTY if the ring is empty, RB_PARAM_ERROR on invalid input
+ * @details The message stays valid until rb_msg_release(). Messages larger than RB_MSG_INLINE_MAX point to
+ *          the producer's buffer.
+ */
+__attribute__((hot))
+int rb_msg_peek(rb_msg_t *r, const void **data, size_t *size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Remove the message returned by rb_msg_peek() (consumer side)
+ * @param rb_msg_t* r     Ring
+ * @return int RB_OK on success, RB_EMPTY if the ring is empty, RB_PARAM_ERROR if the ring is NULL
+ */
+__attribute__((hot))
+int rb_msg_release(rb_msg_t *r);
+
+#endif // RING_BUF_MSG_H
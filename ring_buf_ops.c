@@ -0,0 +1,352 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements streaming operators (filter, map, reduce) over contiguous spans of the integer ring.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include "ring_buf_ops.h"
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * The kernels are branchless loops over plain arrays, so the compiler vectorizes them (-O3 -march=native).
+ * Arithmetic is done on uint64_t: it wraps around instead of overflowing, which is also what the vector
+ * instructions do. Every kernel exists twice: for ring cells (strided idata) and for flat arrays.
+ * The filter is the exception: the compiler does not vectorize a compress (the output index depends on the
+ * previous elements), so it is written with intrinsics: AVX-512 compresses 8 values per step, AVX2 4 values
+ * through a permutation table; the scalar loop is the fallback and handles the tail. Every step stores a whole
+ * vector at out + kept, which never passes in + i + step, so filtering in place is safe.
+ */
+
+/* Keep x if lo <= x <= hi, with one unsigned compare */
+#define RB_OPS_IN_RANGE(x, lo, range) ((uint64_t)(x) - (uint64_t)(lo) <= (range))
+
+/* The vector loads of cells pick idata from every 16 bytes cell */
+_Static_assert(sizeof(cell_t) == 16 && offsetof(cell_t, idata) == 8, "cell_t layout");
+
+#if defined(__AVX512F__)
+/* Number of values the vector filter handles per step */
+#define RB_OPS_VEC 8
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Load the integer values of 8 cells
+ * @param const cell_t* cells Cells
+ * @return __m512i Values
+ */
+static inline __m512i rb_ops_vec_load_cells(const cell_t *cells)
+{
+    const __m512i idx = _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+    __m512i a = _mm512_loadu_si512((const void *)cells);
+    __m512i b = _mm512_loadu_si512((const void *)(cells + 4));
+
+    return _mm512_permutex2var_epi64(a, idx, b);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Store the values of x in [lo, lo + range] contiguously at out
+ * @param __m512i x     Values
+ * @param __m512i lo    Lower bound in every lane
+ * @param __m512i range hi - lo in every lane
+ * @param int64_t* out   Output, room for 8 values
+ * @return size_t Number of kept values
+ */
+static inline size_t rb_ops_vec_filter(__m512i x, __m512i lo, __m512i range, int64_t *out)
+{
+    __mmask8 keep = _mm512_cmple_epu64_mask(_mm512_sub_epi64(x, lo), range);
+
+    _mm512_storeu_si512((void *)out, _mm512_maskz_compress_epi64(keep, x));
+    return (size_t)__builtin_popcount(keep);
+}
+#elif defined(__AVX2__)
+/* Number of values the vector filter handles per step */
+#define RB_OPS_VEC 4
+
+/* For every 4 bit keep mask: the 32 bit lanes which move the kept 64 bit values to the front */
+static const int32_t rb_ops_perm[16][8] __attribute__((aligned(32))) = {
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 1, 0, 0, 0, 0, 0, 0 },
+    { 2, 3, 0, 0, 0, 0, 0, 0 },
+    { 0, 1, 2, 3, 0, 0, 0, 0 },
+    { 4, 5, 0, 0, 0, 0, 0, 0 },
+    { 0, 1, 4, 5, 0, 0, 0, 0 },
+    { 2, 3, 4, 5, 0, 0, 0, 0 },
+    { 0, 1, 2, 3, 4, 5, 0, 0 },
+    { 6, 7, 0, 0, 0, 0, 0, 0 },
+    { 0, 1, 6, 7, 0, 0, 0, 0 },
+    { 2, 3, 6, 7, 0, 0, 0, 0 },
+    { 0, 1, 2, 3, 6, 7, 0, 0 },
+    { 4, 5, 6, 7, 0, 0, 0, 0 },
+    { 0, 1, 4, 5, 6, 7, 0, 0 },
+    { 2, 3, 4, 5, 6, 7, 0, 0 },
+    { 0, 1, 2, 3, 4, 5, 6, 7 },
+};
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Load the integer values of 4 cells
+ * @param const cell_t* cells Cells
+ * @return __m256i Values
+ */
+static inline __m256i rb_ops_vec_load_cells(const cell_t *cells)
+{
+    __m256i a = _mm256_loadu_si256((const __m256i *)cells);
+    __m256i b = _mm256_loadu_si256((const __m256i *)(cells + 2));
+
+    /* [d0 d2 d1 d3] -> [d0 d1 d2 d3] */
+    return _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xD8);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Store the values of x in [lo, lo + range] contiguously at out
+ * @param __m256i x     Values
+ * @param __m256i lo    Lower bound in every lane
+ * @param __m256i range hi - lo in every lane, with the sign bit flipped
+ * @param int64_t* out   Output, room for 4 values
+ * @return size_t Number of kept values
+ */
+static inline size_t rb_ops_vec_filter(__m256i x, __m256i lo, __m256i range, int64_t *out)
+{
+    /* AVX2 has no unsigned 64 bit compare: flip the sign bits and compare signed */
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    __m256i d = _mm256_xor_si256(_mm256_sub_epi64(x, lo), sign);
+    int keep = ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(d, range))) & 0xF;
+    __m256i perm = _mm256_load_si256((const __m256i *)rb_ops_perm[keep]);
+
+    _mm256_storeu_si256((__m256i *)out, _mm256_permutevar8x32_epi32(x, perm));
+    return (size_t)__builtin_popcount(keep);
+}
+#endif
+
+void rb_ops_agg_init(rb_ops_agg_t *agg)
+{
+    agg->sum = 0;
+    agg->min = INT64_MAX;
+    agg->max = INT64_MIN;
+    agg->count = 0;
+}
+
+void rb_ops_load(const cell_t *cells, size_t n, int64_t *out)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = cells[i].idata;
+    }
+}
+
+size_t rb_ops_filter(const int64_t *in, size_t n, int64_t lo, int64_t hi, int64_t *out)
+{
+    uint64_t range = (uint64_t)hi - (uint64_t)lo;
+    size_t kept = 0;
+    size_t i = 0;
+
+    if (lo > hi) return 0;
+
+#if defined(__AVX512F__)
+    __m512i vlo = _mm512_set1_epi64(lo);
+    __m512i vrange = _mm512_set1_epi64((int64_t)range);
+
+    for (; i + RB_OPS_VEC <= n; i += RB_OPS_VEC) {
+        kept += rb_ops_vec_filter(_mm512_loadu_si512((const void *)(in + i)), vlo, vrange, out + kept);
+    }
+#elif defined(__AVX2__)
+    __m256i vlo = _mm256_set1_epi64x(lo);
+    __m256i vrange = _mm256_set1_epi64x((int64_t)(range ^ (uint64_t)INT64_MIN));
+
+    for (; i + RB_OPS_VEC <= n; i += RB_OPS_VEC) {
+        kept += rb_ops_vec_filter(_mm256_loadu_si256((const __m256i *)(in + i)), vlo, vrange, out + kept);
+    }
+#endif
+
+    for (; i < n; i++) {
+        int64_t x = in[i];
+        out[kept] = x;
+        kept += RB_OPS_IN_RANGE(x, lo, range);
+    }
+
+    return kept;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief rb_ops_filter() reading the ring cells in place
+ * @param const cell_t* cells Cells
+ * @param size_t n     Number of cells
+ * @param int64_t lo    Lower bound, inclusive
+ * @param int64_t hi    Upper bound, inclusive
+ * @param int64_t* out   Output
+ * @return size_t Number of kept values
+ */
+static size_t rb_ops_filter_cells(const cell_t *cells, size_t n, int64_t lo, int64_t hi, int64_t *out)
+{
+    uint64_t range = (uint64_t)hi - (uint64_t)lo;
+    size_t kept = 0;
+    size_t i = 0;
+
+    if (lo > hi) return 0;
+
+#if defined(__AVX512F__)
+    __m512i vlo = _mm512_set1_epi64(lo);
+    __m512i vrange = _mm512_set1_epi64((int64_t)range);
+
+    for (; i + RB_OPS_VEC <= n; i += RB_OPS_VEC) {
+        kept += rb_ops_vec_filter(rb_ops_vec_load_cells(cells + i), vlo, vrange, out + kept);
+    }
+#elif defined(__AVX2__)
+    __m256i vlo = _mm256_set1_epi64x(lo);
+    __m256i vrange = _mm256_set1_epi64x((int64_t)(range ^ (uint64_t)INT64_MIN));
+
+    for (; i + RB_OPS_VEC <= n; i += RB_OPS_VEC) {
+        kept += rb_ops_vec_filter(rb_ops_vec_load_cells(cells + i), vlo, vrange, out + kept);
+    }
+#endif
+
+    for (; i < n; i++) {
+        int64_t x = cells[i].idata;
+        out[kept] = x;
+        kept += RB_OPS_IN_RANGE(x, lo, range);
+    }
+
+    return kept;
+}
+
+void rb_ops_map(const int64_t *in, size_t n, int64_t mul, int64_t add, int64_t *out)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (int64_t)((uint64_t)in[i] * (uint64_t)mul + (uint64_t)add);
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief rb_ops_map() reading the ring cells in place
+ * @param const cell_t* cells Cells
+ * @param size_t n     Number of cells
+ * @param int64_t mul   Multiplier
+ * @param int64_t add   Addend
+ * @param int64_t* out   Output
+ */
+static void rb_ops_map_cells(const cell_t *cells, size_t n, int64_t mul, int64_t add, int64_t *out)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = (int64_t)((uint64_t)cells[i].idata * (uint64_t)mul + (uint64_t)add);
+    }
+}
+
+void rb_ops_reduce(const int64_t *in, size_t n, rb_ops_agg_t *agg)
+{
+    uint64_t sum = (uint64_t)agg->sum;
+    int64_t min = agg->min;
+    int64_t max = agg->max;
+
+    for (size_t i = 0; i < n; i++) {
+        int64_t x = in[i];
+        sum += (uint64_t)x;
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+    }
+
+    agg->sum = (int64_t)sum;
+    agg->min = min;
+    agg->max = max;
+    agg->count += n;
+}
+
+void rb_ops_reduce_cells(const cell_t *cells, size_t n, rb_ops_agg_t *agg)
+{
+    uint64_t sum = (uint64_t)agg->sum;
+    int64_t min = agg->min;
+    int64_t max = agg->max;
+
+    for (size_t i = 0; i < n; i++) {
+        int64_t x = cells[i].idata;
+        sum += (uint64_t)x;
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+    }
+
+    agg->sum = (int64_t)sum;
+    agg->min = min;
+    agg->max = max;
+    agg->count += n;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Run the pipeline over one chunk of cells
+ * @param const cell_t* cells Cells, at most RB_OPS_CHUNK
+ * @param size_t n     Number of cells
+ * @param const rb_ops_stage_t* stages Stages
+ * @param size_t num_stages Number of stages, at least 1
+ * @param rb_ops_agg_t* agg   Aggregate to update
+ */
+static void rb_ops_run_chunk(const cell_t *cells, size_t n, const rb_ops_stage_t *stages, size_t num_stages,
+                             rb_ops_agg_t *agg)
+{
+    int64_t scratch[RB_OPS_CHUNK] __attribute__((aligned(64)));
+    size_t count = n;
+
+    /* The first stage reads the ring memory, the others work in place on the scratch buffer */
+    if (RB_OPS_FILTER == stages[0].op) {
+        count = rb_ops_filter_cells(cells, n, stages[0].a, stages[0].b, scratch);
+    } else {
+        rb_ops_map_cells(cells, n, stages[0].a, stages[0].b, scratch);
+    }
+
+    for (size_t s = 1; s < num_stages && count > 0; s++) {
+        if (RB_OPS_FILTER == stages[s].op) {
+            count = rb_ops_filter(scratch, count, stages[s].a, stages[s].b, scratch);
+        } else {
+            rb_ops_map(scratch, count, stages[s].a, stages[s].b, scratch);
+        }
+    }
+
+    rb_ops_reduce(scratch, count, agg);
+}
+
+size_t rb_ops_run(ring_buf_t *d, const rb_ops_stage_t *stages, size_t num_stages, rb_ops_agg_t *agg, size_t max)
+{
+    size_t total = 0;
+
+    if (!d || !agg || (num_stages && !stages) || num_stages > RB_OPS_MAX_STAGES) return 0;
+
+    for (size_t s = 0; s < num_stages; s++) {
+        if (RB_OPS_FILTER != stages[s].op && RB_OPS_MAP != stages[s].op) return 0;
+    }
+
+    /* Not more than one ring worth, so a fast producer can not keep the call running forever */
+    if (0 == max || max > d->capacity) max = d->capacity;
+
+    while (total < max) {
+        cell_t *cells;
+        size_t n = rb_peek_span(d, &cells);
+
+        if (n > max - total) n = max - total;
+        if (0 == n) break;
+
+        for (size_t off = 0; off < n; off += RB_OPS_CHUNK) {
+            size_t len = n - off < RB_OPS_CHUNK ? n - off : RB_OPS_CHUNK;
+
+            if (0 == num_stages) {
+                rb_ops_reduce_cells(cells + off, len, agg);
+            } else {
+                rb_ops_run_chunk(cells + off, len, stages, num_stages, agg);
+            }
+        }
+
+        rb_release_span(d, n);
+        total += n;
+    }
+
+    return total;
+}
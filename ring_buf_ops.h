@@ -0,0 +1,118 @@
+#ifndef RING_BUF_OPS_H
+#define RING_BUF_OPS_H
+
+#include "ring_buf.h"
+
+/* Number of values a pipeline processes at once; the scratch buffer lives on the stack */
+#define RB_OPS_CHUNK 512
+/* Maximal number of stages in one pipeline */
+#define RB_OPS_MAX_STAGES 8
+
+/**
+ * @enum
+ * @brief Stage operators of rb_ops_run()
+ */
+enum {
+    RB_OPS_FILTER = 0,      /**< Keep values in [a, b] */
+    RB_OPS_MAP = 1,         /**< Replace every value x by x * a + b */
+};
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One stage of a pipeline
+ */
+typedef struct {
+    int op;                  /**< RB_OPS_FILTER or RB_OPS_MAP */
+    int64_t a;               /**< Filter: lower bound; map: multiplier */
+    int64_t b;               /**< Filter: upper bound; map: addend */
+} rb_ops_stage_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Aggregate of a stream: the reduce stage of every pipeline
+ * @details The sum wraps around on overflow, like unsigned arithmetic
+ */
+typedef struct {
+    int64_t sum;             /**< Sum of the values */
+    int64_t min;             /**< Minimal value, INT64_MAX if count is 0 */
+    int64_t max;             /**< Maximal value, INT64_MIN if count is 0 */
+    uint64_t count;          /**< Number of values */
+} rb_ops_agg_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Init an empty aggregate
+ * @param rb_ops_agg_t* agg   Aggregate
+ */
+void rb_ops_agg_init(rb_ops_agg_t *agg);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Copy the integer values of ring cells into a flat array
+ * @param const cell_t* cells Cells, e.g. from rb_peek_span()
+ * @param size_t n     Number of cells
+ * @param int64_t* out   Output, n values
+ */
+void rb_ops_load(const cell_t *cells, size_t n, int64_t *out);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Keep the values in [lo, hi]
+ * @param const int64_t* in    Input values
+ * @param size_t n     Number of values
+ * @param int64_t lo    Lower bound, inclusive
+ * @param int64_t hi    Upper bound, inclusive
+ * @param int64_t* out   Output, can be the same as in
+ * @return size_t Number of kept values
+ */
+size_t rb_ops_filter(const int64_t *in, size_t n, int64_t lo, int64_t hi, int64_t *out);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Replace every value x by x * mul + add (wrapping around on overflow)
+ * @param const int64_t* in    Input values
+ * @param size_t n     Number of values
+ * @param int64_t mul   Multiplier
+ * @param int64_t add   Addend
+ * @param int64_t* out   Output, can be the same as in
+ */
+void rb_ops_map(const int64_t *in, size_t n, int64_t mul, int64_t add, int64_t *out);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Add values to an aggregate
+ * @param const int64_t* in    Input values
+ * @param size_t n     Number of values
+ * @param rb_ops_agg_t* agg   Aggregate to update
+ */
+void rb_ops_reduce(const int64_t *in, size_t n, rb_ops_agg_t *agg);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Add the integer values of ring cells to an aggregate, reading the ring memory directly
+ * @param const cell_t* cells Cells, e.g. from rb_peek_span()
+ * @param size_t n     Number of cells
+ * @param rb_ops_agg_t* agg   Aggregate to update
+ */
+void rb_ops_reduce_cells(const cell_t *cells, size_t n, rb_ops_agg_t *agg);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Drain the integer ring through a pipeline of stages into an aggregate (consumer side)
+ * @param ring_buf_t* d     Integer Ring Buffer
+ * @param const rb_ops_stage_t* stages Stages, applied in order; the reduce stage always comes last
+ * @param size_t num_stages Number of stages, up to RB_OPS_MAX_STAGES; 0: reduce only
+ * @param rb_ops_agg_t* agg   Aggregate to update
+ * @param size_t max   Maximal number of records to drain; 0: everything readable now
+ * @return size_t Number of drained records (before filtering); 0 if the ring is empty or on invalid input
+ * @details Works on contiguous spans of the ring (rb_peek_span()), RB_OPS_CHUNK values at a time: the first
+ *          stage reads the cells in place, the following stages work on a scratch buffer on the stack, so no
+ *          stage allocates memory. The head index is published once per span. Map and reduce are plain loops
+ *          written to be auto-vectorized by the compiler; the filter uses AVX-512 or AVX2 intrinsics when the
+ *          target has them, and a scalar loop otherwise.
+ */
+size_t rb_ops_run(ring_buf_t *d, const rb_ops_stage_t *stages, size_t num_stages, rb_ops_agg_t *agg, size_t max);
+
+#endif // RING_BUF_OPS_H
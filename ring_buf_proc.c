@@ -0,0 +1,90 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements the batch event processor: a consumer loop with an end-of-batch callback.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including nanosleep
+
+#include <string.h>
+#include <sched.h>
+#include <time.h>
+#include "ring_buf_proc.h"
+
+int rb_proc_init(rb_proc_t *p, ring_buf_t *ring, rb_proc_handler_t handler, void *ctx)
+{
+    if (!p || !ring || !handler) return RB_PARAM_ERROR;
+
+    memset(p, 0, sizeof(rb_proc_t));
+    p->ring = ring;
+    p->handler = handler;
+    p->ctx = ctx;
+    p->spins = RB_PROC_SPINS;
+    p->yields = RB_PROC_YIELDS;
+    p->sleep_ns = RB_PROC_SLEEP_NS;
+
+    return RB_OK;
+}
+
+__attribute__((hot))
+size_t rb_proc_run_once(rb_proc_t *p)
+{
+    ring_buf_t *d = p->ring;
+    uint64_t head = atomic_load_explicit(&d->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&d->tail, memory_order_acquire);
+    uint64_t mask = d->capacity - 1;
+
+    if (head == tail) return 0;
+
+    for (uint64_t seq = head; seq < tail; seq++) {
+        p->handler(&d->cells[seq & mask], seq, seq + 1 == tail, p->ctx);
+    }
+
+    /* The cells are given back to the producer only after the whole batch is handled */
+    atomic_store_explicit(&d->head, tail, memory_order_release);
+
+    p->events += tail - head;
+    p->batches++;
+
+    return tail - head;
+}
+
+int rb_proc_run(rb_proc_t *p)
+{
+    if (!p || !p->ring || !p->handler) return RB_PARAM_ERROR;
+
+    struct timespec nap = {
+        .tv_sec = p->sleep_ns / 1000000000ULL,
+        .tv_nsec = p->sleep_ns % 1000000000ULL
+    };
+    uint64_t idle = 0;
+
+    while (!atomic_load_explicit(&p->stop, memory_order_acquire)) {
+        if (rb_proc_run_once(p)) {
+            idle = 0;
+            continue;
+        }
+
+        idle++;
+        if (idle <= p->spins) {
+            rb_cpu_relax();
+        } else if (idle <= (uint64_t)p->spins + p->yields) {
+            sched_yield();
+        } else {
+            p->sleeps++;
+            nanosleep(&nap, NULL);
+        }
+    }
+
+    /* Whatever was published before the stop */
+    rb_proc_run_once(p);
+
+    return RB_OK;
+}
+
+void rb_proc_stop(rb_proc_t *p)
+{
+    atomic_store_explicit(&p->stop, 1, memory_order_release);
+}
@@ -0,0 +1,78 @@
+#ifndef RING_BUF_PROC_H
+#define RING_BUF_PROC_H
+
+#include "ring_buf.h"
+
+/* Default backoff of rb_proc_run() on an empty ring: spin, then yield, then sleep */
+#define RB_PROC_SPINS 10000
+#define RB_PROC_YIELDS 100
+#define RB_PROC_SLEEP_NS 50000
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Event handler, called for every record
+ * @param cell_t* cell  The record, valid only during the call
+ * @param uint64_t seq   Sequence (position) of the record in the ring
+ * @param int end_of_batch 1 for the last record currently readable: the moment to flush
+ * @param void* ctx   User context
+ */
+typedef void (*rb_proc_handler_t)(cell_t *cell, uint64_t seq, int end_of_batch, void *ctx);
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Batch event processor: the consumer loop of a ring_buf_t
+ * @details Every pass takes everything currently readable, calls the handler for each record with the
+ *          end-of-batch flag set on the last one, and publishes head once per batch. When the ring is empty,
+ *          rb_proc_run() backs off: it spins, then yields, then sleeps, until rb_proc_stop() is called.
+ */
+typedef struct {
+    ring_buf_t *ring;        /**< Ring to consume */
+    rb_proc_handler_t handler; /**< Event handler */
+    void *ctx;               /**< Handler context */
+    uint32_t spins;          /**< Backoff: empty polls with a CPU relax hint */
+    uint32_t yields;         /**< Backoff: then empty polls with sched_yield() */
+    uint64_t sleep_ns;       /**< Backoff: then sleep that long between polls */
+    int stop;                /**< Set by rb_proc_stop() */
+    uint64_t events;         /**< Statistics: records handled */
+    uint64_t batches;        /**< Statistics: batches handled */
+    uint64_t sleeps;         /**< Statistics: how many times the processor went to sleep */
+} rb_proc_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Init the batch event processor with the default backoff
+ * @param rb_proc_t* p     Processor to init
+ * @param ring_buf_t* ring  Ring to consume
+ * @param rb_proc_handler_t handler Event handler
+ * @param void* ctx   Handler context
+ * @return int RB_OK on success, RB_PARAM_ERROR on invalid input
+ */
+int rb_proc_init(rb_proc_t *p, ring_buf_t *ring, rb_proc_handler_t handler, void *ctx);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Handle everything currently readable, once
+ * @param rb_proc_t* p     Processor
+ * @return size_t Number of handled records, 0 if the ring is empty
+ */
+size_t rb_proc_run_once(rb_proc_t *p);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer loop: handle batches, back off when idle, until rb_proc_stop()
+ * @param rb_proc_t* p     Processor
+ * @return int RB_OK when stopped, RB_PARAM_ERROR on invalid input
+ * @details Records published before the stop was seen are handled before returning. Can be used directly as
+ *          a pthread start routine through a wrapper, or called from an existing consumer thread.
+ */
+int rb_proc_run(rb_proc_t *p);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Ask rb_proc_run() to return; can be called from any thread, also from the handler
+ * @param rb_proc_t* p     Processor
+ */
+void rb_proc_stop(rb_proc_t *p);
+
+#endif // RING_BUF_PROC_H
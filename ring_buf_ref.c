@@ -0,0 +1,161 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a pool of reference counted payloads for multicast delivery over pointer rings.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_ref.h"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: move the buffers returned by the consumers into the free list
+ * @param rb_ref_pool_t* pool  Pool
+ */
+static void rb_ref_collect(rb_ref_pool_t *pool)
+{
+    for (size_t c = 0; c < pool->num_consumers; c++) {
+        for (;;) {
+            void *h = NULL;
+            size_t size = 0;
+
+            if (RB_OK != rb_pull_ptr(pool->returns[c], &h, &size)) break;
+            pool->free_list[pool->free_count++] = h;
+        }
+    }
+}
+
+rb_ref_pool_t *rb_ref_pool_alloc_init(size_t num_bufs, size_t buf_size, size_t num_consumers)
+{
+    rb_ref_pool_t *pool;
+    size_t ring_cells = 2;
+
+    if (0 == num_bufs || 0 == num_consumers) return NULL;
+
+    pool = calloc(1, sizeof(rb_ref_pool_t));
+    if (NULL == pool) return NULL;
+
+    pool->num_bufs = num_bufs;
+    pool->num_consumers = num_consumers;
+    pool->stride = sizeof(rb_ref_t) + ((buf_size + 63) & ~(size_t)63);
+
+    pool->bufs = aligned_alloc(64, num_bufs * pool->stride);
+    pool->free_list = calloc(num_bufs, sizeof(rb_ref_t *));
+    pool->returns = calloc(num_consumers, sizeof(ring_buf_t *));
+    if (NULL == pool->bufs || NULL == pool->free_list || NULL == pool->returns) {
+        perror("Can not allocate memory: ");
+        rb_ref_pool_destroy(pool);
+        return NULL;
+    }
+
+    /* A return ring can hold every buffer of the pool, so returning never fails */
+    while (ring_cells < num_bufs + 1) ring_cells <<= 1;
+
+    for (size_t c = 0; c < num_consumers; c++) {
+        pool->returns[c] = rb_alloc_init(ring_cells, rb_mem_size(ring_cells));
+        if (NULL == pool->returns[c]) {
+            rb_ref_pool_destroy(pool);
+            return NULL;
+        }
+    }
+
+    memset(pool->bufs, 0, num_bufs * pool->stride);
+    for (size_t i = 0; i < num_bufs; i++) {
+        rb_ref_t *h = (rb_ref_t *)(pool->bufs + i * pool->stride);
+
+        h->index = i;
+        h->capacity = pool->stride - sizeof(rb_ref_t);
+        pool->free_list[pool->free_count++] = h;
+    }
+
+    return pool;
+}
+
+void rb_ref_pool_destroy(rb_ref_pool_t *pool)
+{
+    if (!pool) return;
+
+    if (pool->returns) {
+        for (size_t c = 0; c < pool->num_consumers; c++) {
+            if (pool->returns[c]) rb_destroy(pool->returns[c]);
+        }
+    }
+
+    free(pool->returns);
+    free(pool->free_list);
+    free(pool->bufs);
+    free(pool);
+}
+
+rb_ref_t *rb_ref_get(rb_ref_pool_t *pool)
+{
+    if (!pool) return NULL;
+
+    if (0 == pool->free_count) {
+        rb_ref_collect(pool);
+        if (0 == pool->free_count) return NULL;
+    }
+
+    rb_ref_t *h = pool->free_list[--pool->free_count];
+    h->size = 0;
+    return h;
+}
+
+int rb_ref_set_fanout(rb_ref_t *h, uint32_t fanout)
+{
+    if (!h || 0 == fanout) return RB_PARAM_ERROR;
+
+    h->fanout = fanout;
+    atomic_store_explicit(&h->refcnt, fanout, memory_order_relaxed);
+    return RB_OK;
+}
+
+size_t rb_ref_multicast(rb_ref_pool_t *pool, rb_ref_t *h, ring_buf_t **rings, size_t num_rings)
+{
+    size_t pushed = 0;
+
+    if (!pool || !h || !rings || 0 == num_rings || num_rings > UINT32_MAX) return 0;
+
+    /* Every consumer may release before the loop ends, so the count is set up front */
+    if (RB_OK != rb_ref_set_fanout(h, (uint32_t)num_rings)) return 0;
+
+    for (size_t i = 0; i < num_rings; i++) {
+        if (RB_OK == rb_push_ptr(rings[i], h, h->size)) {
+            pushed++;
+        } else {
+            rb_ref_drop(pool, h);
+        }
+    }
+
+    return pushed;
+}
+
+void rb_ref_drop(rb_ref_pool_t *pool, rb_ref_t *h)
+{
+    if (!pool || !h) return;
+
+    if (1 == h->fanout || 1 == atomic_fetch_sub_explicit(&h->refcnt, 1, memory_order_acq_rel)) {
+        pool->free_list[pool->free_count++] = h;
+    }
+}
+
+int rb_ref_release(rb_ref_pool_t *pool, rb_ref_t *h, size_t consumer_id)
+{
+    if (!pool || !h || consumer_id >= pool->num_consumers) return RB_PARAM_ERROR;
+
+    /* Single consumer: it owns the buffer, no need to count */
+    if (1 == h->fanout) {
+        return rb_push_ptr(pool->returns[consumer_id], h, 0);
+    }
+
+    if (1 == atomic_fetch_sub_explicit(&h->refcnt, 1, memory_order_acq_rel)) {
+        return rb_push_ptr(pool->returns[consumer_id], h, 0);
+    }
+
+    return RB_OK;
+}
@@ -0,0 +1,110 @@
+#ifndef RING_BUF_REF_H
+#define RING_BUF_REF_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Reference counted payload handle; the payload follows the header, cache line aligned
+ */
+typedef struct {
+    uint64_t refcnt;         /**< References left; used only when fanout > 1 */
+    uint32_t fanout;         /**< Number of consumers the payload was published to */
+    uint32_t index;          /**< Index of the buffer in its pool */
+    size_t size;             /**< Payload size set by the producer */
+    size_t capacity;         /**< Payload capacity */
+} __attribute__((aligned(64))) rb_ref_t;
+
+/* The payload of a handle */
+#define RB_REF_DATA(h) ((void *)((char *)(h) + sizeof(rb_ref_t)))
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pool of reference counted payloads for multicast delivery
+ * @details The producer takes a buffer from the pool, fills it and publishes it to several consumers, setting
+ *          the fan-out count. Each consumer releases its reference after processing, and the last one returns
+ *          the buffer to the pool. Every consumer has its own return ring (a ring_buf_t where the consumer is
+ *          the producer), so returning a buffer is SPSC and lock-free. When the fan-out is 1 the reference
+ *          count is not touched at all: the single consumer returns the buffer directly, with no atomic
+ *          read-modify-write. The payload is never copied per consumer.
+ */
+typedef struct {
+    size_t num_bufs;         /**< Number of buffers in the pool */
+    size_t stride;           /**< Distance between two handles, bytes */
+    size_t num_consumers;    /**< Number of return rings */
+    ring_buf_t **returns;    /**< Return ring of every consumer */
+    rb_ref_t **free_list;    /**< Producer: buffers ready for use */
+    size_t free_count;       /**< Producer: number of buffers in free_list */
+    char *bufs;              /**< Handles and payloads, one block */
+} rb_ref_pool_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate the pool of reference counted payloads
+ * @param size_t num_bufs      Number of buffers
+ * @param size_t buf_size      Payload capacity of every buffer
+ * @param size_t num_consumers Number of consumers, each gets an id in [0, num_consumers)
+ * @return rb_ref_pool_t* Allocated pool; NULL on error
+ */
+rb_ref_pool_t *rb_ref_pool_alloc_init(size_t num_bufs, size_t buf_size, size_t num_consumers);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the pool and all its buffers
+ * @param rb_ref_pool_t* pool  Pool to free
+ */
+void rb_ref_pool_destroy(rb_ref_pool_t *pool);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Take a free buffer from the pool (producer side)
+ * @param rb_ref_pool_t* pool  Pool
+ * @return rb_ref_t* Buffer handle, use RB_REF_DATA() to reach the payload; NULL if all buffers are in use
+ */
+rb_ref_t *rb_ref_get(rb_ref_pool_t *pool);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Set the fan-out count of a buffer before publishing it (producer side)
+ * @param rb_ref_t* h     Buffer handle
+ * @param uint32_t fanout Number of consumers the buffer is published to, at least 1
+ * @return int RB_OK, or RB_PARAM_ERROR on invalid input
+ * @details The count becomes visible to the consumers with the pointer, through the release store of the
+ *          ring used to publish it
+ */
+int rb_ref_set_fanout(rb_ref_t *h, uint32_t fanout);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Publish a buffer to several pointer rings (producer side)
+ * @param rb_ref_pool_t* pool  Pool the buffer belongs to
+ * @param rb_ref_t* h     Buffer handle; h->size is passed as the record size
+ * @param ring_buf_t** rings Rings of the consumers
+ * @param size_t num_rings Number of rings, 1 to UINT32_MAX
+ * @return size_t Number of rings the buffer was pushed into; the references of the rings which were full
+ *         are dropped, and if none took it the buffer goes back to the pool. 0 on invalid input, the caller
+ *         still owns the buffer then
+ */
+size_t rb_ref_multicast(rb_ref_pool_t *pool, rb_ref_t *h, ring_buf_t **rings, size_t num_rings);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Drop one reference from the producer side, e.g. for a consumer it could not be published to
+ * @param rb_ref_pool_t* pool  Pool the buffer belongs to
+ * @param rb_ref_t* h     Buffer handle
+ */
+void rb_ref_drop(rb_ref_pool_t *pool, rb_ref_t *h);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the reference of a consumer after processing (consumer side)
+ * @param rb_ref_pool_t* pool  Pool the buffer belongs to
+ * @param rb_ref_t* h     Buffer handle
+ * @param size_t consumer_id Id of the calling consumer; every consumer thread must use its own id
+ * @return int RB_OK, or RB_PARAM_ERROR on invalid input
+ */
+int rb_ref_release(rb_ref_pool_t *pool, rb_ref_t *h, size_t consumer_id);
+
+#endif // RING_BUF_REF_H
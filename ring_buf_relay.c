@@ -0,0 +1,333 @@
+#define _GNU_SOURCE  // Enables pthread_attr_setaffinity_np() and the CPU_* macros
+
+/**
+ * This file implements NUMA-local ring placement and a batching relay between two sockets.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <errno.h>
+#include "ring_buf_relay.h"
+#include "ring_buf_mem.h"
+
+#define RB_NUMA_SYSFS "/sys/devices/system/node"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read a sysfs list file, e.g. "0-3,8-11", into a set
+ * @param const char* path  File path
+ * @param cpu_set_t* set   Output: the listed numbers (CPUs or nodes)
+ * @return int RB_OK if the file lists at least one number, RB_ERROR otherwise
+ */
+static int rb_numa_read_list(const char *path, cpu_set_t *set)
+{
+    char list[4096];
+    char *p = list;
+    FILE *f;
+
+    CPU_ZERO(set);
+
+    f = fopen(path, "r");
+    if (NULL == f) return RB_ERROR;
+
+    if (NULL == fgets(list, sizeof(list), f)) list[0] = '\0';
+    fclose(f);
+
+    while (*p >= '0' && *p <= '9') {
+        long first = strtol(p, &p, 10);
+        long last = first;
+
+        if ('-' == *p) last = strtol(p + 1, &p, 10);
+        for (long n = first; n <= last && n < CPU_SETSIZE; n++) {
+            CPU_SET(n, set);
+        }
+        if (',' == *p) p++;
+    }
+
+    return CPU_COUNT(set) > 0 ? RB_OK : RB_ERROR;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read the set of NUMA nodes which have CPUs
+ * @param cpu_set_t* nodes Output: node ids; they can be sparse
+ * @return int RB_OK on success, RB_ERROR if NUMA information is not available
+ * @details Memory-only nodes are skipped: there is no CPU to place a thread or a first touch on
+ */
+static int rb_numa_nodes(cpu_set_t *nodes)
+{
+    if (RB_OK == rb_numa_read_list(RB_NUMA_SYSFS "/has_cpu", nodes)) return RB_OK;
+
+    /* Older kernels: all online nodes; the memory-only ones are filtered by their empty CPU list */
+    return rb_numa_read_list(RB_NUMA_SYSFS "/online", nodes);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read the CPUs of a NUMA node
+ * @param int node  Node number
+ * @param cpu_set_t* set   Output: the CPUs of the node
+ * @return int RB_OK on success, RB_ERROR if the node does not exist or has no CPU
+ * @details Without NUMA information the machine is one node 0 with all the online CPUs
+ */
+static int rb_numa_node_cpus(int node, cpu_set_t *set)
+{
+    char path[128];
+    cpu_set_t nodes;
+
+    if (node < 0 || node >= CPU_SETSIZE) return RB_ERROR;
+
+    snprintf(path, sizeof(path), RB_NUMA_SYSFS "/node%d/cpulist", node);
+    if (RB_OK == rb_numa_read_list(path, set)) return RB_OK;
+
+    if (0 == node && RB_OK != rb_numa_nodes(&nodes)) {
+        long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+        CPU_ZERO(set);
+        for (long cpu = 0; cpu < num_cpus && cpu < CPU_SETSIZE; cpu++) {
+            CPU_SET(cpu, set);
+        }
+        return RB_OK;
+    }
+
+    return RB_ERROR;
+}
+
+int rb_numa_next_node(int node)
+{
+    cpu_set_t nodes;
+    cpu_set_t set;
+
+    if (RB_OK != rb_numa_nodes(&nodes)) return node < 0 ? 0 : RB_PARAM_ERROR;
+
+    for (int next = node < 0 ? 0 : node + 1; next < CPU_SETSIZE; next++) {
+        if (CPU_ISSET(next, &nodes) && RB_OK == rb_numa_node_cpus(next, &set)) return next;
+    }
+
+    return RB_PARAM_ERROR;
+}
+
+int rb_numa_num_nodes(void)
+{
+    int count = 0;
+
+    for (int node = rb_numa_next_node(-1); node >= 0; node = rb_numa_next_node(node)) {
+        count++;
+    }
+
+    return count > 0 ? count : 1;
+}
+
+int rb_numa_next_cpu(int node, int cpu)
+{
+    cpu_set_t set;
+
+    if (RB_OK != rb_numa_node_cpus(node, &set)) return RB_PARAM_ERROR;
+
+    for (int next = cpu < 0 ? 0 : cpu + 1; next < CPU_SETSIZE; next++) {
+        if (CPU_ISSET(next, &set)) return next;
+    }
+
+    return RB_PARAM_ERROR;
+}
+
+int rb_numa_first_cpu(int node)
+{
+    return rb_numa_next_cpu(node, -1);
+}
+
+int rb_numa_node_of_cpu(int cpu)
+{
+    cpu_set_t set;
+
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return RB_PARAM_ERROR;
+
+    for (int node = rb_numa_next_node(-1); node >= 0; node = rb_numa_next_node(node)) {
+        if (RB_OK == rb_numa_node_cpus(node, &set) && CPU_ISSET(cpu, &set)) return node;
+    }
+
+    return RB_PARAM_ERROR;
+}
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Arguments of rb_alloc_node_thread()
+ */
+typedef struct {
+    size_t num_cells;        /**< Cells of the ring */
+    size_t max_alloc_size;   /**< Maximum allowed memory to allocate */
+    ring_buf_t *ring;        /**< Output: allocated ring */
+} rb_alloc_node_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Helper thread, pinned to the target node: allocate the ring and touch all its pages
+ * @param void* arg   rb_alloc_node_t
+ * @return void* Ignored
+ */
+static void *rb_alloc_node_thread(void *arg)
+{
+    rb_alloc_node_t *a = arg;
+
+    a->ring = rb_alloc_init_mode(a->num_cells, a->max_alloc_size, RB_INIT_TOUCH);
+    return NULL;
+}
+
+ring_buf_t *rb_alloc_init_node(size_t num_cells, size_t max_alloc_size, int node)
+{
+    rb_alloc_node_t a = { .num_cells = num_cells, .max_alloc_size = max_alloc_size, .ring = NULL };
+    pthread_attr_t attr;
+    pthread_t thread;
+    cpu_set_t set;
+    int rc;
+
+    if (node < 0) return rb_alloc_init(num_cells, max_alloc_size);
+
+    if (RB_OK != rb_numa_node_cpus(node, &set)) return NULL;
+
+    if (0 != pthread_attr_init(&attr)) return NULL;
+    pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &set);
+    rc = pthread_create(&thread, &attr, rb_alloc_node_thread, &a);
+    pthread_attr_destroy(&attr);
+
+    if (0 != rc) {
+        errno = rc;
+        perror("Can not create the allocation thread: ");
+        return NULL;
+    }
+
+    pthread_join(thread, NULL);
+    return a.ring;
+}
+
+rb_relay_t *rb_relay_alloc_init(size_t local_cells, size_t remote_cells, int local_node, int remote_node,
+                                size_t batch, size_t max_alloc_size)
+{
+    rb_relay_t *r;
+
+    if (batch > RB_RELAY_BATCH) return NULL;
+
+    r = calloc(1, sizeof(rb_relay_t));
+    if (NULL == r) {
+        perror("Can not allocate memory: ");
+        return NULL;
+    }
+
+    r->batch = batch ? batch : RB_RELAY_BATCH;
+    r->local = rb_alloc_init_node(local_cells, max_alloc_size, local_node);
+    r->remote = rb_alloc_init_node(remote_cells, max_alloc_size, remote_node);
+    if (NULL == r->local || NULL == r->remote) {
+        rb_relay_destroy(r);
+        return NULL;
+    }
+
+    return r;
+}
+
+void rb_relay_destroy(rb_relay_t *r)
+{
+    if (!r) return;
+
+    rb_relay_stop(r);
+    rb_destroy(r->local);
+    rb_destroy(r->remote);
+    free(r);
+}
+
+size_t rb_relay_poll(rb_relay_t *r)
+{
+    cell_t *cells;
+    size_t n = rb_peek_span(r->local, &cells);
+
+    if (0 == n) return 0;
+    if (n > r->batch) n = r->batch;
+
+    /* Reading the local cells is a socket-local access; the remote ring gets one tail update per batch */
+    n = rb_push_cells(r->remote, cells, n);
+    if (0 == n) {
+        r->full++;
+        return 0;
+    }
+
+    rb_release_span(r->local, n);
+    r->moved += n;
+    r->batches++;
+
+    return n;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Relay thread: move batches until stopped, then drain the local ring
+ * @param void* arg   Relay
+ * @return void* Ignored
+ */
+static void *rb_relay_main(void *arg)
+{
+    rb_relay_t *r = arg;
+    unsigned int idle = 0;
+
+    for (;;) {
+        int stop = atomic_load_explicit(&r->stop, memory_order_acquire);
+
+        if (rb_relay_poll(r) > 0) {
+            idle = 0;
+            continue;
+        }
+
+        /* Everything pushed before the stop is moved */
+        if (stop && atomic_load_explicit(&r->local->tail, memory_order_acquire) ==
+            atomic_load_explicit(&r->local->head, memory_order_relaxed)) {
+            break;
+        }
+
+        if (++idle < RB_RELAY_SPINS) {
+            rb_cpu_relax();
+        } else {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+int rb_relay_start(rb_relay_t *r, int cpu)
+{
+    pthread_attr_t attr;
+    int rc;
+
+    if (!r || r->running) return RB_PARAM_ERROR;
+    if (0 != pthread_attr_init(&attr)) return RB_ERROR;
+
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+        cpu_set_t set;
+
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &set);
+    }
+
+    atomic_store_explicit(&r->stop, 0, memory_order_relaxed);
+    rc = pthread_create(&r->thread, &attr, rb_relay_main, r);
+    pthread_attr_destroy(&attr);
+
+    if (0 != rc) {
+        errno = rc;
+        perror("Can not create the relay thread: ");
+        return RB_ERROR;
+    }
+
+    r->running = 1;
+    return RB_OK;
+}
+
+void rb_relay_stop(rb_relay_t *r)
+{
+    if (!r || !r->running) return;
+
+    atomic_store_explicit(&r->stop, 1, memory_order_release);
+    pthread_join(r->thread, NULL);
+    r->running = 0;
+}
@@ -0,0 +1,135 @@
+#ifndef RING_BUF_RELAY_H
+#define RING_BUF_RELAY_H
+
+#include "ring_buf.h"
+
+/* Maximal number of cells the relay moves with one tail update of the remote ring */
+#define RB_RELAY_BATCH 256
+/* The relay thread spins that many times on an empty local ring before yielding the CPU */
+#define RB_RELAY_SPINS 1000
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the number of NUMA nodes with CPUs
+ * @return int Number of nodes listed in /sys/devices/system/node/has_cpu; 1 if NUMA information is not
+ *         available
+ * @details Node ids can be sparse: walk them with rb_numa_next_node()
+ */
+int rb_numa_num_nodes(void);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the next NUMA node with CPUs
+ * @param int node  Previous node; -1 for the first one
+ * @return int Node number; RB_PARAM_ERROR if there is no next node. Without NUMA information there is one
+ *         node 0 with all the online CPUs.
+ */
+int rb_numa_next_node(int node);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the NUMA node of a CPU
+ * @param int cpu   CPU number
+ * @return int Node number; RB_PARAM_ERROR if the CPU is not found
+ */
+int rb_numa_node_of_cpu(int cpu);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the first CPU of a NUMA node
+ * @param int node  Node number
+ * @return int CPU number; RB_PARAM_ERROR if the node has no CPU
+ */
+int rb_numa_first_cpu(int node);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the next CPU of a NUMA node, e.g. to place a helper thread next to a pinned one
+ * @param int node  Node number
+ * @param int cpu   Previous CPU; -1 for the first one
+ * @return int CPU number; RB_PARAM_ERROR if the node has no CPU after cpu
+ */
+int rb_numa_next_cpu(int node, int cpu);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the Ring Buffer in the memory of a NUMA node
+ * @param size_t num_cells     How many records should be in the Ring Buffer, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @param int node  NUMA node; -1 to allocate from the calling thread as rb_alloc_init() does
+ * @return ring_buf_t* Allocated and inited Ring Buffer structure; NULL on error
+ * @details The kernel places a page on the node of the CPU which touches it first. The ring is mapped without
+ *          touching anything, then a helper thread pinned to the CPUs of the node pre-faults all the pages,
+ *          the control structure included. No libnuma is needed. Release it with rb_destroy() as usual.
+ */
+ring_buf_t *rb_alloc_init_node(size_t num_cells, size_t max_alloc_size, int node);
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Cross-socket relay: a local ring, a relay thread, a remote ring
+ * @details When the producer and the consumer sit on different sockets, every tail update of a direct SPSC ring
+ *          crosses the interconnect, and so does every cell. With the relay, the producer pushes into the local
+ *          ring, placed on its own node, so its stores and index updates stay on the socket. The relay thread,
+ *          running on the producer socket too, moves the cells to the remote ring, placed on the consumer node,
+ *          up to RB_RELAY_BATCH cells with one tail update. The consumer pulls from the remote ring as usual.
+ *          Both rings are plain ring_buf_t: integer and pointer records both pass, order is kept.
+ */
+typedef struct {
+    ring_buf_t *local;       /**< Producer side ring, on the producer node */
+    ring_buf_t *remote;      /**< Consumer side ring, on the consumer node */
+    size_t batch;            /**< Cells moved with one tail update, up to RB_RELAY_BATCH */
+    pthread_t thread;        /**< Relay thread */
+    int running;             /**< 1 between rb_relay_start() and rb_relay_stop() */
+    int stop;                /**< Asks the relay thread to drain and exit */
+    uint64_t moved;          /**< Statistics: cells moved */
+    uint64_t batches;        /**< Statistics: tail updates of the remote ring */
+    uint64_t full;           /**< Statistics: polls which found the remote ring full */
+} rb_relay_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate the relay and its two rings
+ * @param size_t local_cells  Cells of the local ring, power of 2
+ * @param size_t remote_cells Cells of the remote ring, power of 2
+ * @param int local_node  NUMA node of the producer, -1 for no placement
+ * @param int remote_node NUMA node of the consumer, -1 for no placement
+ * @param size_t batch  Cells moved with one tail update, 1 to RB_RELAY_BATCH; 0 for RB_RELAY_BATCH
+ * @param size_t max_alloc_size Maximum allowed memory to allocate for one ring
+ * @return rb_relay_t* Allocated relay; NULL on error
+ */
+rb_relay_t *rb_relay_alloc_init(size_t local_cells, size_t remote_cells, int local_node, int remote_node,
+                                size_t batch, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Stop the relay thread if it runs, release the relay and both rings
+ * @param rb_relay_t* r     Relay
+ */
+void rb_relay_destroy(rb_relay_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Move one batch from the local ring to the remote ring; the body of the relay thread
+ * @param rb_relay_t* r     Relay
+ * @return size_t Number of moved cells; 0 if the local ring is empty or the remote ring is full
+ */
+size_t rb_relay_poll(rb_relay_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Start the relay thread
+ * @param rb_relay_t* r     Relay
+ * @param int cpu   CPU to pin the thread to, on the producer socket; -1 to not pin it
+ * @return int RB_OK on success, RB_ERROR if the thread could not be created, RB_PARAM_ERROR if it runs
+ */
+int rb_relay_start(rb_relay_t *r, int cpu);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Stop the relay thread after it moved everything pushed before; the consumer must keep pulling
+ * @param rb_relay_t* r     Relay
+ */
+void rb_relay_stop(rb_relay_t *r);
+
+#endif // RING_BUF_RELAY_H
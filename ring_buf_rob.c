@@ -0,0 +1,90 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a reorder buffer: out-of-order completion, in-order commit.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_rob.h"
+
+rb_rob_t *rb_rob_alloc_init(size_t num_cells, size_t max_alloc_size)
+{
+    size_t total_memory;
+    rb_rob_t *rob;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    total_memory = sizeof(rb_rob_t) + num_cells * sizeof(rb_rob_slot_t);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    rob = aligned_alloc(64, total_memory);
+    if (NULL == rob) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(rob, 0, total_memory);
+    rob->capacity = num_cells;
+    rob->max_alloc_size = max_alloc_size;
+
+    return rob;
+}
+
+void rb_rob_destroy(rb_rob_t *rob)
+{
+    free(rob);
+}
+
+int rb_rob_reserve(rb_rob_t *rob, uint64_t *seq)
+{
+    if (!rob || !seq) return RB_PARAM_ERROR;
+
+    if (rob->next_seq - rob->cached_head == rob->capacity) {
+        rob->cached_head = atomic_load_explicit(&rob->head, memory_order_acquire);
+        if (rob->next_seq - rob->cached_head == rob->capacity) return RB_FULL;
+    }
+
+    *seq = rob->next_seq++;
+    return RB_OK;
+}
+
+int rb_rob_complete(rb_rob_t *rob, uint64_t seq, void *data, size_t size)
+{
+    if (!rob) return RB_PARAM_ERROR;
+
+    rb_rob_slot_t *slot = &rob->slots[seq & (rob->capacity - 1)];
+
+    slot->data = data;
+    slot->size = size;
+    atomic_store_explicit(&slot->seq, seq + 1, memory_order_release);
+
+    return RB_OK;
+}
+
+int rb_rob_pull(rb_rob_t *rob, void **data, size_t *size)
+{
+    if (!rob || !data || !size) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&rob->head, memory_order_relaxed);
+    rb_rob_slot_t *slot = &rob->slots[head & (rob->capacity - 1)];
+
+    if (atomic_load_explicit(&slot->seq, memory_order_acquire) != head + 1) {
+        return RB_EMPTY; // The next sequence is still being processed
+    }
+
+    *data = slot->data;
+    *size = slot->size;
+
+    atomic_store_explicit(&rob->head, head + 1, memory_order_release);
+    return RB_OK;
+}
@@ -0,0 +1,86 @@
+#ifndef RING_BUF_ROB_H
+#define RING_BUF_ROB_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One completion slot of the reorder buffer, on its own cache line so workers do not share lines
+ */
+typedef struct {
+    uint64_t seq;            /**< Sequence + 1 once the result of that sequence is stored */
+    void *data;              /**< Result pointer */
+    uint64_t size;           /**< Result size */
+} __attribute__((aligned(64))) rb_rob_slot_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Reorder buffer: parallel out-of-order processing with in-order commit
+ * @details The dispatcher (one thread, usually the consumer of the input ring) tags every item with a
+ *          sequence number from rb_rob_reserve() and hands it to any worker. Workers complete items in any
+ *          order with rb_rob_complete(), which stores the result in the slot indexed by the sequence. The
+ *          publisher (one thread, may be the dispatcher) takes results with rb_rob_pull() only in sequence
+ *          order: it advances over contiguous completed sequences and stops at the first gap. At most
+ *          capacity items are in flight; rb_rob_reserve() returns RB_FULL beyond that. The control structure
+ *          and the slots are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t capacity;       /**< Number of slots (power of 2): maximal number of items in flight */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t next_seq __attribute__((aligned(64))); /**< Dispatcher: next sequence to give */
+    uint64_t cached_head;    /**< Dispatcher: last seen publisher position */
+    uint64_t head __attribute__((aligned(64)));     /**< Publisher: next sequence to emit */
+    rb_rob_slot_t slots[];   /**< Completion slots */
+} rb_rob_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the reorder buffer
+ * @param size_t num_cells     Maximal number of items in flight, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @return rb_rob_t* Allocated and inited reorder buffer; NULL on error
+ */
+rb_rob_t *rb_rob_alloc_init(size_t num_cells, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the reorder buffer
+ * @param rb_rob_t* rob   Reorder buffer to free
+ */
+void rb_rob_destroy(rb_rob_t *rob);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Give the next sequence number to an item (dispatcher side)
+ * @param rb_rob_t* rob   Reorder buffer
+ * @param uint64_t* seq   Output: the sequence of the item
+ * @return int RB_OK on success, RB_FULL if capacity items are in flight, RB_PARAM_ERROR on invalid input
+ */
+int rb_rob_reserve(rb_rob_t *rob, uint64_t *seq);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Store the result of a processed item (any worker)
+ * @param rb_rob_t* rob   Reorder buffer
+ * @param uint64_t seq   Sequence given by rb_rob_reserve()
+ * @param void* data  Result pointer
+ * @param size_t size  Result size
+ * @return int RB_OK on success, RB_PARAM_ERROR if the buffer pointer is invalid
+ * @details Every reserved sequence must be completed exactly once, or the publisher stops at it
+ */
+int rb_rob_complete(rb_rob_t *rob, uint64_t seq, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Take the next result in sequence order (publisher side)
+ * @param rb_rob_t* rob   Reorder buffer
+ * @param void** data  Output: result pointer
+ * @param size_t* size  Output: result size
+ * @return int RB_OK on success, RB_EMPTY if the next sequence is not completed yet, RB_PARAM_ERROR on invalid
+ *         input
+ */
+int rb_rob_pull(rb_rob_t *rob, void **data, size_t *size);
+
+#endif // RING_BUF_ROB_H
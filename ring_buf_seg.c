@@ -0,0 +1,246 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements an unbounded SPSC queue built from chained Ring Buffer segments.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_seg.h"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate a new empty segment
+ * @param rb_seg_queue_t* q     Queue the segment belongs to
+ * @return rb_seg_t* New segment; NULL on error
+ */
+static rb_seg_t *rb_seg_new(rb_seg_queue_t *q)
+{
+    rb_seg_t *seg = aligned_alloc(64, q->seg_size);
+    if (NULL == seg) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(seg, 0, q->seg_size);
+    RB_SEG_RING(seg)->capacity = q->seg_cells;
+    RB_SEG_RING(seg)->max_alloc_size = q->seg_size;
+
+    atomic_fetch_add_explicit(&q->seg_count, 1, memory_order_relaxed);
+    return seg;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Free a segment
+ * @param rb_seg_queue_t* q     Queue the segment belongs to
+ * @param rb_seg_t* seg   Segment to free
+ */
+static void rb_seg_free(rb_seg_queue_t *q, rb_seg_t *seg)
+{
+    atomic_fetch_sub_explicit(&q->seg_count, 1, memory_order_relaxed);
+    free(seg);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: get an empty segment, take it from the recycle ring if possible
+ * @param rb_seg_queue_t* q     Queue
+ * @return rb_seg_t* Empty segment, not linked yet; NULL on error
+ */
+static rb_seg_t *rb_seg_get(rb_seg_queue_t *q)
+{
+    void *seg = NULL;
+    size_t size = 0;
+
+    if (RB_OK == rb_pull_ptr(q->recycle, &seg, &size)) {
+        return seg;
+    }
+
+    return rb_seg_new(q);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer side: return a drained segment to the producer, or free it if enough are cached
+ * @param rb_seg_queue_t* q     Queue
+ * @param rb_seg_t* seg   Drained segment
+ */
+static void rb_seg_put(rb_seg_queue_t *q, rb_seg_t *seg)
+{
+    seg->next = NULL;
+    if (RB_OK != rb_push_ptr(q->recycle, seg, q->seg_size)) {
+        rb_seg_free(q, seg);
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: link a segment after the tail one and make it the new tail
+ * @param rb_seg_queue_t* q     Queue
+ * @param rb_seg_t* seg   Segment to link, already holds the first record
+ */
+static inline void rb_seg_link(rb_seg_queue_t *q, rb_seg_t *seg)
+{
+    atomic_store_explicit(&q->tail_seg->next, seg, memory_order_release);
+    q->tail_seg = seg;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer side: the head segment is empty, switch to the next one
+ * @param rb_seg_queue_t* q     Queue
+ * @details The producer links the next segment only after the current one became full, so all records of
+ *          the current segment are visible once the link is seen. The caller must retry the current segment
+ *          after reading the link, the records could be pushed between its first try and reading the link.
+ */
+static inline void rb_seg_next(rb_seg_queue_t *q)
+{
+    rb_seg_t *old = q->head_seg;
+    q->head_seg = old->next;
+    rb_seg_put(q, old);
+}
+
+rb_seg_queue_t *rb_seg_alloc_init(size_t seg_cells, size_t recycle_cells)
+{
+    rb_seg_queue_t *q;
+
+    if (seg_cells < 2 || (seg_cells & (seg_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    q = aligned_alloc(64, sizeof(rb_seg_queue_t));
+    if (NULL == q) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(q, 0, sizeof(rb_seg_queue_t));
+    q->seg_cells = seg_cells;
+    q->seg_size = sizeof(rb_seg_t) + sizeof(ring_buf_t) + seg_cells * sizeof(cell_t);
+
+    q->recycle = rb_alloc_init(recycle_cells, recycle_cells * sizeof(cell_t) + sizeof(ring_buf_t));
+    if (NULL == q->recycle) {
+        free(q);
+        return NULL;
+    }
+
+    q->head_seg = q->tail_seg = rb_seg_new(q);
+    if (NULL == q->head_seg) {
+        rb_destroy(q->recycle);
+        free(q);
+        return NULL;
+    }
+
+    return q;
+}
+
+void rb_seg_destroy(rb_seg_queue_t *q)
+{
+    if (!q) return;
+
+    rb_seg_trim(q);
+    while (q->head_seg) {
+        rb_seg_t *next = q->head_seg->next;
+        rb_seg_free(q, q->head_seg);
+        q->head_seg = next;
+    }
+
+    rb_destroy(q->recycle);
+    free(q);
+}
+
+int rb_seg_push_ptr(rb_seg_queue_t *q, void *data, size_t size)
+{
+    if (!q) return RB_PARAM_ERROR;
+
+    int rc = rb_push_ptr(RB_SEG_RING(q->tail_seg), data, size);
+    if (RB_FULL != rc) return rc;
+
+    rb_seg_t *seg = rb_seg_get(q);
+    if (NULL == seg) return RB_MEMORY_FAIL;
+
+    rb_push_ptr(RB_SEG_RING(seg), data, size);
+    rb_seg_link(q, seg);
+    return RB_OK;
+}
+
+int rb_seg_pull_ptr(rb_seg_queue_t *q, void **data, size_t *size)
+{
+    if (!q || !data || !size) return RB_PARAM_ERROR;
+
+    for (;;) {
+        int rc = rb_pull_ptr(RB_SEG_RING(q->head_seg), data, size);
+        if (RB_EMPTY != rc) return rc;
+
+        if (NULL == atomic_load_explicit(&q->head_seg->next, memory_order_acquire)) return RB_EMPTY;
+
+        rc = rb_pull_ptr(RB_SEG_RING(q->head_seg), data, size);
+        if (RB_EMPTY != rc) return rc;
+
+        rb_seg_next(q);
+    }
+}
+
+__attribute__((hot))
+int rb_seg_push_int(rb_seg_queue_t *q, int64_t idata)
+{
+    if (!q) return RB_PARAM_ERROR;
+
+    int rc = rb_push_int(RB_SEG_RING(q->tail_seg), idata);
+    if (RB_FULL != rc) return rc;
+
+    rb_seg_t *seg = rb_seg_get(q);
+    if (NULL == seg) return RB_MEMORY_FAIL;
+
+    rb_push_int(RB_SEG_RING(seg), idata);
+    rb_seg_link(q, seg);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_seg_pull_int(rb_seg_queue_t *q, int64_t *idata)
+{
+    if (!q || !idata) return RB_PARAM_ERROR;
+
+    for (;;) {
+        int rc = rb_pull_int(RB_SEG_RING(q->head_seg), idata);
+        if (RB_EMPTY != rc) return rc;
+
+        if (NULL == atomic_load_explicit(&q->head_seg->next, memory_order_acquire)) return RB_EMPTY;
+
+        rc = rb_pull_int(RB_SEG_RING(q->head_seg), idata);
+        if (RB_EMPTY != rc) return rc;
+
+        rb_seg_next(q);
+    }
+}
+
+size_t rb_seg_trim(rb_seg_queue_t *q)
+{
+    size_t freed = 0;
+
+    if (!q) return 0;
+
+    for (;;) {
+        void *seg = NULL;
+        size_t size = 0;
+
+        if (RB_OK != rb_pull_ptr(q->recycle, &seg, &size)) break;
+        rb_seg_free(q, seg);
+        freed++;
+    }
+
+    return freed;
+}
+
+size_t rb_seg_mem_usage(rb_seg_queue_t *q)
+{
+    if (!q) return 0;
+    return atomic_load_explicit(&q->seg_count, memory_order_relaxed) * q->seg_size;
+}
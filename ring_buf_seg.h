@@ -0,0 +1,119 @@
+#ifndef RING_BUF_SEG_H
+#define RING_BUF_SEG_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One segment of the unbounded queue
+ * @details The segment header and its Ring Buffer are allocated as a single memory block; the ring_buf_t
+ *          starts right after the header, on its own cache line. Use RB_SEG_RING() to reach it.
+ */
+typedef struct rb_seg_struct {
+    struct rb_seg_struct *next; /**< Next segment; written once by the producer when this one is full */
+    uint64_t _pad[7];           /**< Keep the segment ring on its own cache line */
+} rb_seg_t;
+
+#define RB_SEG_RING(seg) ((ring_buf_t *)((char *)(seg) + sizeof(rb_seg_t)))
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Unbounded single-producer / single-consumer queue built from chained Ring Buffer segments
+ * @details The producer writes into the tail segment. When it is full, the producer takes a segment from the
+ *          recycle ring (or allocates a new one) and links it after the full one. The consumer drains the
+ *          head segment, moves to the next one and returns the drained segment into the recycle ring. The
+ *          recycle ring is itself a ring_buf_t where the consumer is the producer, so in steady state no
+ *          allocation happens at all. When the recycle ring is full the consumer frees the segment, and
+ *          rb_seg_trim() releases all cached segments after a burst.
+ */
+typedef struct {
+    rb_seg_t *tail_seg __attribute__((aligned(64))); /**< Producer: segment being written */
+    rb_seg_t *head_seg __attribute__((aligned(64))); /**< Consumer: segment being read */
+    ring_buf_t *recycle __attribute__((aligned(64)));/**< Drained segments: consumer -> producer */
+    size_t seg_cells;        /**< Number of cells in every segment (power of 2) */
+    size_t seg_size;         /**< Size in bytes of one segment, header included */
+    uint64_t seg_count;      /**< Number of allocated segments, updated atomically */
+} rb_seg_queue_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the unbounded segmented queue
+ * @param size_t seg_cells     Number of cells in one segment, must be power of 2
+ * @param size_t recycle_cells Size of the recycle ring, must be power of 2; up to (recycle_cells - 1)
+ *        drained segments are kept for reuse
+ * @return rb_seg_queue_t* Allocated queue with one empty segment; NULL on error
+ */
+rb_seg_queue_t *rb_seg_alloc_init(size_t seg_cells, size_t recycle_cells);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the queue, all its segments and all cached segments
+ * @param rb_seg_queue_t* q     Queue to release
+ * @details Payloads still in the queue are not touched
+ */
+void rb_seg_destroy(rb_seg_queue_t *q);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a pointer and the buffer size in the queue (producer side)
+ * @param rb_seg_queue_t* q     Queue
+ * @param void* data  Pointer to a buffer to save
+ * @param size_t size  Size of the saved buffer
+ * @return int RB_OK if saved, RB_PARAM_ERROR if the queue is NULL, RB_MEMORY_FAIL if a new segment is needed
+ *         but could not be allocated
+ */
+int rb_seg_push_ptr(rb_seg_queue_t *q, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer from the queue (consumer side)
+ * @param rb_seg_queue_t* q     Queue
+ * @param void** data  Double pointer; must point to NULL, the pointer to a buffer will be copied into
+ * @param size_t* size  Must point to 0; size of returned buffer
+ * @return int RB_OK on success, RB_PARAM_ERROR if one of input pointers is invalid; RB_EMPTY if the queue is
+ *         empty
+ */
+int rb_seg_pull_ptr(rb_seg_queue_t *q, void **data, size_t *size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Push an integer value to the queue (producer side)
+ * @param rb_seg_queue_t* q     Queue
+ * @param int64_t idata Integer value to save
+ * @return int RB_OK if saved, RB_PARAM_ERROR if the queue is NULL, RB_MEMORY_FAIL if a new segment is needed
+ *         but could not be allocated
+ */
+__attribute__((hot))
+int rb_seg_push_int(rb_seg_queue_t *q, int64_t idata);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Extract an integer value from the queue (consumer side)
+ * @param rb_seg_queue_t* q     Queue
+ * @param int64_t* idata Pointer to integer, the value will be copied into
+ * @return int RB_OK if a value extracted; RB_PARAM_ERROR if one of pointers is invalid; RB_EMPTY if the
+ *         queue is empty
+ */
+__attribute__((hot))
+int rb_seg_pull_int(rb_seg_queue_t *q, int64_t *idata);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Free all segments cached in the recycle ring (producer side)
+ * @param rb_seg_queue_t* q     Queue
+ * @return size_t Number of freed segments
+ * @details Call it after a burst to give the memory back. Segments still in use are not touched.
+ */
+size_t rb_seg_trim(rb_seg_queue_t *q);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Return the memory currently held by the queue segments
+ * @param rb_seg_queue_t* q     Queue
+ * @return size_t Number of bytes allocated for segments, cached ones included
+ */
+size_t rb_seg_mem_usage(rb_seg_queue_t *q);
+
+#endif // RING_BUF_SEG_H
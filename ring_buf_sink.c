@@ -0,0 +1,217 @@
+#define _GNU_SOURCE  // Enables writev() / fdatasync() and IOV_MAX
+
+/**
+ * This file implements a write-behind file sink: batched writev() and fdatasync() group commits.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "ring_buf_sink.h"
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get current monotonic time in nanoseconds
+ * @return uint64_t Current time
+ */
+static inline uint64_t rb_sink_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write all the buffers of the vector, in IOV_MAX chunks, resuming after partial writes
+ * @param rb_sink_t* s     Sink
+ * @param struct iovec* iov   Buffers; modified
+ * @param int cnt   Number of buffers
+ * @return int RB_OK on success, RB_ERROR on write error
+ */
+static int rb_sink_writev_all(rb_sink_t *s, struct iovec *iov, int cnt)
+{
+    while (cnt > 0) {
+        ssize_t rc = writev(s->fd, iov, cnt < IOV_MAX ? cnt : IOV_MAX);
+
+        if (rc < 0) {
+            if (EINTR == errno) continue;
+            perror("Can not write the sink file: ");
+            s->stats.errors++;
+            return RB_ERROR;
+        }
+        s->stats.writev_calls++;
+
+        /* Skip what is written: whole buffers, then a part of the next one */
+        while (cnt > 0 && (size_t)rc >= iov->iov_len) {
+            rc -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if (cnt > 0) {
+            iov->iov_base = (char *)iov->iov_base + rc;
+            iov->iov_len -= rc;
+        }
+    }
+
+    return RB_OK;
+}
+
+rb_sink_t *rb_sink_alloc_init(ring_buf_t *ring, int fd, uint64_t commit_bytes, uint64_t commit_ns,
+                              rb_sink_release_fn_t release_fn, rb_sink_commit_fn_t commit_fn, void *ctx)
+{
+    rb_sink_t *s;
+
+    if (!ring || fd < 0) return NULL;
+
+    s = calloc(1, sizeof(rb_sink_t));
+    if (NULL == s) {
+        perror("Can not allocate memory: ");
+        return NULL;
+    }
+
+    s->ring = ring;
+    s->fd = fd;
+    s->commit_bytes = commit_bytes;
+    s->commit_ns = commit_ns;
+    s->release_fn = release_fn;
+    s->commit_fn = commit_fn;
+    s->ctx = ctx;
+
+    return s;
+}
+
+void rb_sink_destroy(rb_sink_t *s)
+{
+    free(s);
+}
+
+int rb_sink_commit(rb_sink_t *s)
+{
+    if (!s) return RB_PARAM_ERROR;
+    if (0 == s->pending_records) return RB_OK;
+
+    uint64_t start_ns = rb_sink_now_ns();
+    int rc = fdatasync(s->fd);
+    uint64_t end_ns = rb_sink_now_ns();
+
+    if (rc < 0) {
+        /* The kernel reports a writeback error once: the pending data is lost, do not retry it forever */
+        perror("Can not sync the sink file: ");
+        s->stats.errors++;
+        s->pending_bytes = 0;
+        s->pending_records = 0;
+        return RB_ERROR;
+    }
+
+    rb_sink_commit_t commit = {
+        .bytes = s->pending_bytes,
+        .records = s->pending_records,
+        .latency_ns = end_ns - start_ns,
+        .age_ns = end_ns - s->pending_since_ns,
+    };
+
+    s->stats.commits++;
+    s->stats.commit_ns += commit.latency_ns;
+    if (commit.latency_ns > s->stats.commit_ns_max) s->stats.commit_ns_max = commit.latency_ns;
+
+    s->pending_bytes = 0;
+    s->pending_records = 0;
+
+    if (s->commit_fn) s->commit_fn(&commit, s->ctx);
+
+    return RB_OK;
+}
+
+int rb_sink_poll(rb_sink_t *s)
+{
+    struct iovec iov[RB_SINK_BATCH];
+    size_t pulled = 0;
+    int cnt = 0;
+    int rc = RB_EMPTY;
+
+    if (!s) return RB_PARAM_ERROR;
+
+    if (RB_OK == rb_pull_ptr_batch(s->ring, s->data, s->sizes, RB_SINK_BATCH, &pulled)) {
+        uint64_t bytes = 0;
+
+        for (size_t i = 0; i < pulled; i++) {
+            if (0 == s->sizes[i]) continue;
+            iov[cnt].iov_base = s->data[i];
+            iov[cnt].iov_len = s->sizes[i];
+            bytes += s->sizes[i];
+            cnt++;
+        }
+
+        rc = rb_sink_writev_all(s, iov, cnt);
+
+        if (s->release_fn) {
+            for (size_t i = 0; i < pulled; i++) {
+                s->release_fn(s->data[i], s->sizes[i], s->ctx);
+            }
+        }
+
+        if (RB_OK == rc) {
+            if (0 == s->pending_records) s->pending_since_ns = rb_sink_now_ns();
+            s->pending_bytes += bytes;
+            s->pending_records += pulled;
+            s->stats.bytes += bytes;
+            s->stats.records += pulled;
+        }
+    }
+
+    if (RB_ERROR == rc || 0 == s->pending_records) return rc;
+
+    /* Group commit */
+    if ((s->commit_bytes && s->pending_bytes >= s->commit_bytes) ||
+        (s->commit_ns && rb_sink_now_ns() - s->pending_since_ns >= s->commit_ns)) {
+        return rb_sink_commit(s);
+    }
+
+    return rc;
+}
+
+int rb_sink_run(rb_sink_t *s)
+{
+    struct timespec nap = { .tv_sec = 0, .tv_nsec = RB_SINK_IDLE_NS };
+    int result = RB_OK;
+
+    if (!s) return RB_PARAM_ERROR;
+
+    for (;;) {
+        int stop = atomic_load_explicit(&s->stop, memory_order_acquire);
+        int rc = rb_sink_poll(s);
+
+        if (RB_ERROR == rc) result = RB_ERROR;
+        if (RB_EMPTY != rc) continue;
+
+        /* The ring is drained: everything published before the stop is written */
+        if (stop) break;
+        nanosleep(&nap, NULL);
+    }
+
+    if (RB_OK != rb_sink_commit(s)) result = RB_ERROR;
+
+    return result;
+}
+
+void rb_sink_stop(rb_sink_t *s)
+{
+    atomic_store_explicit(&s->stop, 1, memory_order_release);
+}
+
+int rb_sink_get_stats(rb_sink_t *s, rb_sink_stats_t *stats)
+{
+    if (!s || !stats) return RB_PARAM_ERROR;
+
+    *stats = s->stats;
+    return RB_OK;
+}
@@ -0,0 +1,147 @@
+#ifndef RING_BUF_SINK_H
+#define RING_BUF_SINK_H
+
+#include "ring_buf.h"
+
+/* Maximal number of buffers drained from the ring and written by one writev() batch */
+#define RB_SINK_BATCH 512
+/* rb_sink_run() sleeps that long when the ring is empty */
+#define RB_SINK_IDLE_NS 100000
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Report of one group commit, passed to the commit callback
+ */
+typedef struct {
+    uint64_t bytes;          /**< Bytes made durable by this commit */
+    uint64_t records;        /**< Records made durable by this commit */
+    uint64_t latency_ns;     /**< Duration of the fdatasync() call */
+    uint64_t age_ns;         /**< How long the oldest record of the commit waited since it was written */
+} rb_sink_commit_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Sink statistics, see rb_sink_get_stats()
+ */
+typedef struct {
+    uint64_t records;        /**< Records written */
+    uint64_t bytes;          /**< Bytes written */
+    uint64_t writev_calls;   /**< writev() system calls */
+    uint64_t commits;        /**< fdatasync() group commits */
+    uint64_t commit_ns;      /**< Total time spent in fdatasync() */
+    uint64_t commit_ns_max;  /**< Longest fdatasync() */
+    uint64_t errors;         /**< Failed writev() or fdatasync() calls */
+} rb_sink_stats_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Called for every buffer once it is written (in the page cache, not committed yet)
+ * @param void* data  Buffer pulled from the ring
+ * @param size_t size  Size of the buffer
+ * @param void* ctx   User context
+ */
+typedef void (*rb_sink_release_fn_t)(void *data, size_t size, void *ctx);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Called after every group commit
+ * @param const rb_sink_commit_t* commit Commit report
+ * @param void* ctx   User context
+ */
+typedef void (*rb_sink_commit_fn_t)(const rb_sink_commit_t *commit, void *ctx);
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write-behind file sink: the consumer of a pointer ring which persists every record
+ * @details Every poll drains up to RB_SINK_BATCH buffers from the ring with one head update
+ *          (rb_pull_ptr_batch()) and writes all of them with writev(), split by IOV_MAX and resumed after
+ *          partial writes. Written data is made durable by fdatasync() group commits: when commit_bytes are
+ *          pending, or when the oldest pending record is commit_ns old. There is no system call per message.
+ */
+typedef struct {
+    ring_buf_t *ring;        /**< Pointer ring to drain */
+    int fd;                  /**< Output file descriptor, owned by the caller */
+    uint64_t commit_bytes;   /**< Commit when that many bytes are pending; 0: no size threshold */
+    uint64_t commit_ns;      /**< Commit when the oldest pending record is that old; 0: no time threshold */
+    rb_sink_release_fn_t release_fn; /**< Buffer release callback, can be NULL */
+    rb_sink_commit_fn_t commit_fn;   /**< Commit report callback, can be NULL */
+    void *ctx;               /**< Context of the callbacks */
+    int stop;                /**< Set by rb_sink_stop() */
+
+    uint64_t pending_bytes;  /**< Written, not committed yet */
+    uint64_t pending_records; /**< Written, not committed yet */
+    uint64_t pending_since_ns; /**< When the oldest pending record was written */
+    rb_sink_stats_t stats;   /**< Statistics */
+
+    void *data[RB_SINK_BATCH];   /**< Batch: buffer pointers */
+    size_t sizes[RB_SINK_BATCH]; /**< Batch: buffer sizes */
+} rb_sink_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the sink
+ * @param ring_buf_t* ring  Pointer ring to drain; the sink is its consumer
+ * @param int fd    Output file descriptor; not closed by the sink
+ * @param uint64_t commit_bytes Size threshold of the group commit, 0 to disable
+ * @param uint64_t commit_ns Time threshold of the group commit, 0 to disable
+ * @param rb_sink_release_fn_t release_fn Called for every written buffer, can be NULL
+ * @param rb_sink_commit_fn_t commit_fn Called after every commit, can be NULL
+ * @param void* ctx   Context of the callbacks
+ * @return rb_sink_t* Allocated sink; NULL on error
+ */
+rb_sink_t *rb_sink_alloc_init(ring_buf_t *ring, int fd, uint64_t commit_bytes, uint64_t commit_ns,
+                              rb_sink_release_fn_t release_fn, rb_sink_commit_fn_t commit_fn, void *ctx);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the sink; pending data is not committed, call rb_sink_commit() before
+ * @param rb_sink_t* s     Sink
+ */
+void rb_sink_destroy(rb_sink_t *s);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Drain one batch from the ring, write it, commit if a threshold is reached
+ * @param rb_sink_t* s     Sink
+ * @return int RB_OK if something was written or committed, RB_EMPTY if there was nothing to do, RB_ERROR if
+ *         writev() or fdatasync() failed (the buffers are released anyway), RB_PARAM_ERROR on invalid input
+ */
+int rb_sink_poll(rb_sink_t *s);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Commit everything written so far, regardless of the thresholds
+ * @param rb_sink_t* s     Sink
+ * @return int RB_OK on success or if nothing is pending, RB_ERROR if fdatasync() failed, RB_PARAM_ERROR on
+ *         invalid input
+ */
+int rb_sink_commit(rb_sink_t *s);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer loop: poll, sleep when idle, until rb_sink_stop(); then drain the ring and commit
+ * @param rb_sink_t* s     Sink
+ * @return int RB_OK when stopped, RB_ERROR if an I/O error happened, RB_PARAM_ERROR on invalid input
+ */
+int rb_sink_run(rb_sink_t *s);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Ask rb_sink_run() to return; can be called from any thread
+ * @param rb_sink_t* s     Sink
+ */
+void rb_sink_stop(rb_sink_t *s);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read the sink statistics (from the consumer thread, or after rb_sink_run() returned)
+ * @param rb_sink_t* s     Sink
+ * @param rb_sink_stats_t* stats Output
+ * @return int RB_OK, or RB_PARAM_ERROR if one of pointers is invalid
+ */
+int rb_sink_get_stats(rb_sink_t *s, rb_sink_stats_t *stats);
+
+#endif // RING_BUF_SINK_H
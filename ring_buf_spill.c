@@ -0,0 +1,355 @@
+#define _GNU_SOURCE  // Enables pread() / pwrite()
+
+/**
+ * This file implements a pointer Ring Buffer which spills records into a file instead of returning RB_FULL.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include "ring_buf_spill.h"
+
+/* Every spilled record is written as this header followed by the payload; the header is padded so the payload
+ * is aligned for any type */
+typedef struct {
+    _Alignas(max_align_t) uint32_t size;
+} rb_spill_hdr_t;
+
+/* Size of a spilled record in the file: rounded up, so the next header and payload stay aligned too */
+#define RB_SPILL_REC_SIZE(size) \
+    ((sizeof(rb_spill_hdr_t) + (size) + sizeof(rb_spill_hdr_t) - 1) & ~(sizeof(rb_spill_hdr_t) - 1))
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get current monotonic time in nanoseconds
+ * @return uint64_t Current time
+ */
+static inline uint64_t rb_spill_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: add to a statistics counter, which other threads may read concurrently
+ * @param uint64_t* counter Counter to update
+ * @param uint64_t value   Value to add
+ */
+static inline void rb_spill_stat_add(uint64_t *counter, uint64_t value)
+{
+    /* The producer is the only writer, so a plain read of its own counter is safe */
+    atomic_store_explicit(counter, *counter + value, memory_order_relaxed);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write the whole buffer at the given file offset
+ * @param int fd    File descriptor
+ * @param const void* buf   Buffer to write
+ * @param size_t len   Number of bytes
+ * @param uint64_t off   File offset
+ * @return int RB_OK on success, RB_ERROR on write error
+ */
+static int rb_spill_write_all(int fd, const void *buf, size_t len, uint64_t off)
+{
+    const char *p = buf;
+
+    while (len > 0) {
+        ssize_t rc = pwrite(fd, p, len, off);
+        if (rc < 0) {
+            perror("Can not write the spill file: ");
+            return RB_ERROR;
+        }
+        p += rc;
+        off += rc;
+        len -= rc;
+    }
+
+    return RB_OK;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: append one record to the spill file through the write batch buffer
+ * @param rb_spill_t* s     Spilling Ring Buffer
+ * @param void* data  Payload
+ * @param size_t size  Payload size
+ * @return int RB_OK on success, RB_ERROR on write error
+ */
+static int rb_spill_append(rb_spill_t *s, void *data, size_t size)
+{
+    rb_spill_hdr_t hdr = { .size = (uint32_t)size };
+    size_t need = RB_SPILL_REC_SIZE(size);
+
+    if (s->wbuf_len + need > s->wbuf_size) {
+        if (RB_OK != rb_spill_flush(s)) return RB_ERROR;
+    }
+
+    /* A record bigger than the batch buffer goes directly into the file */
+    if (need > s->wbuf_size) {
+        if (RB_OK != rb_spill_write_all(s->fd, &hdr, sizeof(hdr), s->written)) return RB_ERROR;
+        if (RB_OK != rb_spill_write_all(s->fd, data, size, s->written + sizeof(hdr))) return RB_ERROR;
+        if (RB_OK != rb_spill_write_all(s->fd, &(rb_spill_hdr_t){ .size = 0 }, need - sizeof(hdr) - size,
+                                        s->written + sizeof(hdr) + size)) {
+            return RB_ERROR;
+        }
+        atomic_store_explicit(&s->written, s->written + need, memory_order_release);
+        return RB_OK;
+    }
+
+    memcpy(s->wbuf + s->wbuf_len, &hdr, sizeof(hdr));
+    memcpy(s->wbuf + s->wbuf_len + sizeof(hdr), data, size);
+    memset(s->wbuf + s->wbuf_len + sizeof(hdr) + size, 0, need - sizeof(hdr) - size);
+    s->wbuf_len += need;
+    return RB_OK;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer side: make sure the next spilled record is in the read buffer
+ * @param rb_spill_t* s     Spilling Ring Buffer
+ * @param uint64_t epoch Spill epoch the consumer reads
+ * @return int RB_OK if a whole record is in the read buffer, RB_EMPTY if it is not written yet or the spill
+ *         epoch is over, RB_ERROR or RB_MEMORY_FAIL on error
+ */
+static int rb_spill_fill(rb_spill_t *s, uint64_t epoch)
+{
+    rb_spill_hdr_t hdr;
+    size_t need = sizeof(hdr);
+
+    if (s->rbuf_len - s->rbuf_pos >= sizeof(hdr)) {
+        memcpy(&hdr, s->rbuf + s->rbuf_pos, sizeof(hdr));
+        need = RB_SPILL_REC_SIZE(hdr.size);
+        if (s->rbuf_len - s->rbuf_pos >= need) return RB_OK;
+    }
+
+    uint64_t written = atomic_load_explicit(&s->written, memory_order_acquire);
+
+    /* The producer resets the file only after it left this epoch: the offsets belong to another spill */
+    if (atomic_load_explicit(&s->epoch, memory_order_relaxed) != epoch) return RB_EMPTY;
+    if (written == s->read_off + s->rbuf_len) return RB_EMPTY;
+
+    /* Move the partial record to the buffer start, then read as much as possible after it */
+    memmove(s->rbuf, s->rbuf + s->rbuf_pos, s->rbuf_len - s->rbuf_pos);
+    s->read_off += s->rbuf_pos;
+    s->rbuf_len -= s->rbuf_pos;
+    s->rbuf_pos = 0;
+
+    if (need > s->rbuf_size) {
+        char *rbuf = realloc(s->rbuf, need);
+        if (NULL == rbuf) return RB_MEMORY_FAIL;
+        s->rbuf = rbuf;
+        s->rbuf_size = need;
+    }
+
+    uint64_t avail = written - (s->read_off + s->rbuf_len);
+    size_t room = s->rbuf_size - s->rbuf_len;
+    size_t len = avail < room ? avail : room;
+
+    while (len > 0) {
+        ssize_t rc = pread(s->fd, s->rbuf + s->rbuf_len, len, s->read_off + s->rbuf_len);
+        if (rc <= 0) {
+            perror("Can not read the spill file: ");
+            return RB_ERROR;
+        }
+        s->rbuf_len += rc;
+        len -= rc;
+    }
+
+    return rb_spill_fill(s, epoch);
+}
+
+rb_spill_t *rb_spill_alloc_init(size_t num_cells, size_t max_alloc_size, const char *path, size_t batch_size)
+{
+    rb_spill_t *s;
+
+    if (!path || batch_size < sizeof(rb_spill_hdr_t)) return NULL;
+
+    s = aligned_alloc(64, sizeof(rb_spill_t));
+    if (NULL == s) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(s, 0, sizeof(rb_spill_t));
+    s->fd = -1;
+    s->wbuf_size = s->rbuf_size = batch_size;
+
+    s->ring = rb_alloc_init(num_cells, max_alloc_size);
+    s->path = strdup(path);
+    s->wbuf = malloc(batch_size);
+    s->rbuf = malloc(batch_size);
+    if (NULL == s->ring || NULL == s->path || NULL == s->wbuf || NULL == s->rbuf) {
+        rb_spill_destroy(s);
+        return NULL;
+    }
+
+    s->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (s->fd < 0) {
+        perror("Can not open the spill file: ");
+        rb_spill_destroy(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+void rb_spill_destroy(rb_spill_t *s)
+{
+    if (!s) return;
+
+    if (s->fd >= 0) {
+        close(s->fd);
+        unlink(s->path);
+    }
+
+    if (s->ring) rb_destroy(s->ring);
+    free(s->path);
+    free(s->wbuf);
+    free(s->rbuf);
+    free(s);
+}
+
+int rb_spill_flush(rb_spill_t *s)
+{
+    if (!s) return RB_PARAM_ERROR;
+    if (0 == s->wbuf_len) return RB_OK;
+
+    if (RB_OK != rb_spill_write_all(s->fd, s->wbuf, s->wbuf_len, s->written)) return RB_ERROR;
+
+    atomic_store_explicit(&s->written, s->written + s->wbuf_len, memory_order_release);
+    s->wbuf_len = 0;
+    return RB_OK;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: leave the spill mode when the consumer acknowledged the drained spill file
+ * @param rb_spill_t* s     Spilling Ring Buffer
+ * @param uint64_t epoch Current epoch, odd
+ * @details The acknowledgement alone is not enough: the producer could spill more records after the consumer
+ *          found the file drained, so the read counter is checked too. After the new epoch is published no
+ *          consumer reads the file any more, and it is truncated.
+ */
+static void rb_spill_check_drained(rb_spill_t *s, uint64_t epoch)
+{
+    if (atomic_load_explicit(&s->ack, memory_order_acquire) != epoch) return;
+    if (atomic_load_explicit(&s->read_records, memory_order_acquire) != s->stats.spilled_records) return;
+
+    atomic_store_explicit(&s->epoch, epoch + 1, memory_order_release);
+    rb_spill_stat_add(&s->stats.spill_ns, rb_spill_now_ns() - s->spill_start_ns);
+
+    if (ftruncate(s->fd, 0) < 0) {
+        /* Not fatal: the next spill overwrites the file from offset 0 */
+        perror("Can not truncate the spill file: ");
+    }
+    atomic_store_explicit(&s->written, 0, memory_order_release);
+}
+
+int rb_spill_push(rb_spill_t *s, void *data, size_t size)
+{
+    if (!s || (!data && size) || size > UINT32_MAX - 2 * sizeof(rb_spill_hdr_t)) return RB_PARAM_ERROR;
+
+    uint64_t epoch = atomic_load_explicit(&s->epoch, memory_order_relaxed);
+
+    /* Leave the spill mode only when the consumer read everything spilled */
+    if (epoch & 1) {
+        rb_spill_check_drained(s, epoch);
+        epoch = atomic_load_explicit(&s->epoch, memory_order_relaxed);
+    }
+
+    if (!(epoch & 1)) {
+        int rc = rb_push_ptr(s->ring, data, size);
+        if (RB_FULL != rc) return rc;
+
+        /* The start time is set before the new epoch, which is published before the first spilled record */
+        atomic_store_explicit(&s->spill_start_ns, rb_spill_now_ns(), memory_order_relaxed);
+        atomic_store_explicit(&s->epoch, epoch + 1, memory_order_release);
+        rb_spill_stat_add(&s->stats.spill_entries, 1);
+    }
+
+    if (RB_OK != rb_spill_append(s, data, size)) return RB_ERROR;
+
+    rb_spill_stat_add(&s->stats.spilled_records, 1);
+    rb_spill_stat_add(&s->stats.spilled_bytes, size);
+
+    /* The consumer drained the in-memory ring and waits for the spilled records: don't keep them */
+    if (atomic_load_explicit(&s->ring->head, memory_order_acquire) ==
+        atomic_load_explicit(&s->ring->tail, memory_order_relaxed)) {
+        if (RB_OK != rb_spill_flush(s)) return RB_ERROR;
+    }
+
+    return RB_SPILLED;
+}
+
+int rb_spill_pull(rb_spill_t *s, void **data, size_t *size)
+{
+    if (!s || !data || !size) return RB_PARAM_ERROR;
+
+    for (;;) {
+        uint64_t epoch = atomic_load_explicit(&s->epoch, memory_order_acquire);
+
+        int rc = rb_pull_ptr(s->ring, data, size);
+        if (RB_EMPTY != rc) return rc;
+
+        /* Not in the spill mode: the file can only hold records of a later spill */
+        if (!(epoch & 1)) return RB_EMPTY;
+
+        /* A new spill starts at offset 0 of the truncated file */
+        if (s->read_epoch != epoch) {
+            s->read_epoch = epoch;
+            s->read_off = 0;
+            s->rbuf_pos = 0;
+            s->rbuf_len = 0;
+        }
+
+        rc = rb_spill_fill(s, epoch);
+        if (RB_OK == rc) break;
+        if (RB_EMPTY != rc) return rc;
+
+        /* The producer left the spill mode meanwhile: read the ring again */
+        if (atomic_load_explicit(&s->epoch, memory_order_acquire) != epoch) continue;
+
+        /* The ring and the file are drained: let the producer leave the spill mode */
+        if (atomic_load_explicit(&s->ack, memory_order_relaxed) != epoch) {
+            atomic_store_explicit(&s->ack, epoch, memory_order_release);
+        }
+        return RB_EMPTY;
+    }
+
+    rb_spill_hdr_t hdr;
+    memcpy(&hdr, s->rbuf + s->rbuf_pos, sizeof(hdr));
+
+    *data = s->rbuf + s->rbuf_pos + sizeof(hdr);
+    *size = hdr.size;
+    s->rbuf_pos += RB_SPILL_REC_SIZE(hdr.size);
+
+    atomic_store_explicit(&s->read_records, s->read_records + 1, memory_order_release);
+    return RB_SPILLED;
+}
+
+int rb_spill_get_stats(rb_spill_t *s, rb_spill_stats_t *stats)
+{
+    if (!s || !stats) return RB_PARAM_ERROR;
+
+    /* Pairs with the epoch store in rb_spill_push(): in the spill mode spill_start_ns is the current start */
+    uint64_t epoch = atomic_load_explicit(&s->epoch, memory_order_acquire);
+
+    stats->spilled_bytes = atomic_load_explicit(&s->stats.spilled_bytes, memory_order_relaxed);
+    stats->spilled_records = atomic_load_explicit(&s->stats.spilled_records, memory_order_relaxed);
+    stats->spill_entries = atomic_load_explicit(&s->stats.spill_entries, memory_order_relaxed);
+    stats->spill_ns = atomic_load_explicit(&s->stats.spill_ns, memory_order_relaxed);
+
+    if (epoch & 1) {
+        uint64_t start_ns = atomic_load_explicit(&s->spill_start_ns, memory_order_relaxed);
+        uint64_t now_ns = rb_spill_now_ns();
+        if (now_ns > start_ns) stats->spill_ns += now_ns - start_ns;
+    }
+
+    return RB_OK;
+}
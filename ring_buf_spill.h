@@ -0,0 +1,123 @@
+#ifndef RING_BUF_SPILL_H
+#define RING_BUF_SPILL_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Spill statistics, see rb_spill_get_stats()
+ */
+typedef struct {
+    uint64_t spilled_bytes;   /**< Payload bytes written into the spill file */
+    uint64_t spilled_records; /**< Records written into the spill file */
+    uint64_t spill_entries;   /**< How many times the producer switched to the spill mode */
+    uint64_t spill_ns;        /**< Time spent in the spill mode, nanoseconds */
+} rb_spill_stats_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pointer Ring Buffer which never returns RB_FULL: records which do not fit go into a spill file
+ * @details When the in-memory ring is full, the producer switches to the spill mode: the payload is copied
+ *          into a write buffer, which is appended to the spill file in large sequential batches. The producer
+ *          stays in the spill mode until the consumer read every spilled record, so new records never
+ *          overtake spilled ones. The consumer drains the in-memory ring first (these records are older than
+ *          anything spilled), then reads the spill file in large batches.
+ *          The switches are ordered by an epoch counter written by the producer, odd in the spill mode. The
+ *          producer leaves the spill mode only after the consumer acknowledged the epoch, having found the ring
+ *          and the file drained; then it truncates the file and starts the next spill at offset 0. The consumer
+ *          reads the epoch before the ring and reads the file only while the epoch stays the same, so it never
+ *          takes a record of a later spill before the ring records pushed in between.
+ *          Every spilled payload starts on a max_align_t boundary. The spill file is removed by
+ *          rb_spill_destroy().
+ */
+typedef struct {
+    ring_buf_t *ring;        /**< In-memory pointer ring */
+    int fd;                  /**< Spill file descriptor */
+    char *path;              /**< Spill file path */
+
+    /* Producer side */
+    uint64_t epoch __attribute__((aligned(64))); /**< Odd while the producer is in the spill mode */
+    char *wbuf;              /**< Write batch buffer */
+    size_t wbuf_size;        /**< Size of the write batch buffer */
+    size_t wbuf_len;         /**< Bytes waiting in the write batch buffer */
+    uint64_t written;        /**< Bytes written into the spill file, published to the consumer */
+    uint64_t spill_start_ns; /**< When the current spill mode started; atomic, read by rb_spill_get_stats() */
+    rb_spill_stats_t stats;  /**< Statistics; written by the producer only, with relaxed atomic stores */
+
+    /* Consumer side */
+    uint64_t read_records __attribute__((aligned(64))); /**< Spilled records the consumer read */
+    uint64_t ack;            /**< Last spill epoch the consumer drained */
+    uint64_t read_epoch;     /**< Spill epoch of the read buffer and read_off */
+    uint64_t read_off;       /**< File offset of the first byte in the read buffer */
+    char *rbuf;              /**< Read batch buffer */
+    size_t rbuf_size;        /**< Size of the read batch buffer */
+    size_t rbuf_pos;         /**< Next record in the read buffer */
+    size_t rbuf_len;         /**< Valid bytes in the read buffer */
+} rb_spill_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the spilling Ring Buffer
+ * @param size_t num_cells      How many records should be in the in-memory ring, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate for the in-memory ring
+ * @param const char* path     Spill file path; the file is created or truncated
+ * @param size_t batch_size     Size of the write and read batch buffers, bytes
+ * @return rb_spill_t* Allocated and inited structure; NULL on error
+ */
+rb_spill_t *rb_spill_alloc_init(size_t num_cells, size_t max_alloc_size, const char *path, size_t batch_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the spilling Ring Buffer and remove its spill file
+ * @param rb_spill_t* s     Structure to release
+ */
+void rb_spill_destroy(rb_spill_t *s);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a buffer (producer side)
+ * @param rb_spill_t* s     Spilling Ring Buffer
+ * @param void* data  Pointer to a buffer to save
+ * @param size_t size  Size of the buffer
+ * @return int RB_OK if the pointer is saved in the in-memory ring (the consumer owns the buffer now);
+ *         RB_SPILLED if the payload is copied into the spill file (the caller still owns the buffer);
+ *         RB_PARAM_ERROR on invalid input; RB_ERROR if the spill file could not be written
+ */
+int rb_spill_push(rb_spill_t *s, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Write the pending batch into the spill file (producer side)
+ * @param rb_spill_t* s     Spilling Ring Buffer
+ * @return int RB_OK on success, RB_ERROR if the file could not be written
+ * @details Batches are flushed when full or when the consumer drained the in-memory ring. A producer which
+ *          goes idle while spilling should call it, otherwise the last batch stays invisible to the consumer.
+ */
+int rb_spill_flush(rb_spill_t *s);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer (consumer side)
+ * @param rb_spill_t* s     Spilling Ring Buffer
+ * @param void** data  Double pointer; must point to NULL, the pointer to a buffer will be copied into
+ * @param size_t* size  Must point to 0; size of returned buffer
+ * @return int RB_OK if the buffer comes from the in-memory ring; RB_SPILLED if it was read from the spill
+ *         file: it points into the internal read buffer and is valid until the next call;
+ *         RB_EMPTY if there is nothing to read; RB_PARAM_ERROR on invalid input; RB_ERROR on read error
+ */
+int rb_spill_pull(rb_spill_t *s, void **data, size_t *size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read the spill statistics (any thread)
+ * @param rb_spill_t* s     Spilling Ring Buffer
+ * @param rb_spill_stats_t* stats Output; spill_ns includes the current spill period
+ * @return int RB_OK, or RB_PARAM_ERROR if one of pointers is invalid
+ * @details Every counter is read atomically, but not all of them at once: a snapshot taken while the producer
+ *          switches modes may be one record or one spill period behind.
+ */
+int rb_spill_get_stats(rb_spill_t *s, rb_spill_stats_t *stats);
+
+#endif // RING_BUF_SPILL_H
@@ -0,0 +1,80 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a lock-free triple buffer for "latest state" exchange of large frames.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_tb.h"
+
+rb_tb_t *rb_tb_alloc_init(size_t frame_size, size_t max_alloc_size)
+{
+    size_t total_memory;
+    rb_tb_t *tb;
+
+    if (0 == frame_size) return NULL;
+
+    frame_size = (frame_size + 63) & ~(size_t)63;
+    total_memory = sizeof(rb_tb_t) + 3 * frame_size;
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    tb = aligned_alloc(64, total_memory);
+    if (NULL == tb) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(tb, 0, total_memory);
+    tb->frame_size = frame_size;
+    tb->max_alloc_size = max_alloc_size;
+    tb->back = 0;
+    atomic_init(&tb->middle, 1);
+    tb->front = 2;
+
+    return tb;
+}
+
+void rb_tb_destroy(rb_tb_t *tb)
+{
+    free(tb);
+}
+
+void *rb_tb_write_buf(rb_tb_t *tb)
+{
+    if (!tb) return NULL;
+    return tb->frames + tb->back * tb->frame_size;
+}
+
+int rb_tb_publish(rb_tb_t *tb)
+{
+    if (!tb) return RB_PARAM_ERROR;
+
+    uint64_t old = atomic_exchange_explicit(&tb->middle, tb->back | RB_TB_DIRTY, memory_order_acq_rel);
+    tb->back = old & RB_TB_INDEX_MASK;
+    tb->published++;
+
+    return RB_OK;
+}
+
+int rb_tb_read(rb_tb_t *tb, const void **frame)
+{
+    if (!tb || !frame) return RB_PARAM_ERROR;
+
+    int rc = RB_EMPTY;
+
+    if (atomic_load_explicit(&tb->middle, memory_order_relaxed) & RB_TB_DIRTY) {
+        uint64_t old = atomic_exchange_explicit(&tb->middle, tb->front, memory_order_acq_rel);
+        tb->front = old & RB_TB_INDEX_MASK;
+        rc = RB_OK;
+    }
+
+    *frame = tb->frames + tb->front * tb->frame_size;
+    return rc;
+}
@@ -0,0 +1,76 @@
+#ifndef RING_BUF_TB_H
+#define RING_BUF_TB_H
+
+#include "ring_buf.h"
+
+/* Bit of rb_tb_t::middle: the middle frame holds a frame the reader did not take yet */
+#define RB_TB_DIRTY 4U
+#define RB_TB_INDEX_MASK 3U
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Lock-free triple buffer: exchanges the latest frame between one writer and one reader
+ * @details Three frames: the writer owns the back one, the reader owns the front one, and the middle one is
+ *          exchanged atomically. The writer publishes by swapping its back frame with the middle one, so it
+ *          always has a free frame to write into. The reader swaps its front frame with the middle one only if
+ *          a new frame was published, so it always gets the most recent complete frame without copying, and
+ *          never sees stale frames one by one. The control structure and the frames are allocated as a single
+ *          memory block.
+ */
+typedef struct {
+    uint64_t frame_size;     /**< Size of one frame, rounded up to the cache line */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t middle __attribute__((aligned(64))); /**< Exchanged frame index | RB_TB_DIRTY */
+    uint64_t back __attribute__((aligned(64)));   /**< Writer: frame being written */
+    uint64_t published;      /**< Writer: number of published frames */
+    uint64_t front __attribute__((aligned(64)));  /**< Reader: frame being read */
+    char frames[] __attribute__((aligned(64)));   /**< Three frames */
+} rb_tb_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the triple buffer
+ * @param size_t frame_size     Size of one frame
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @return rb_tb_t* Allocated and inited triple buffer, all frames zeroed; NULL on error
+ */
+rb_tb_t *rb_tb_alloc_init(size_t frame_size, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the triple buffer
+ * @param rb_tb_t* tb    Triple buffer to free
+ */
+void rb_tb_destroy(rb_tb_t *tb);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the frame to write the next snapshot into (writer side)
+ * @param rb_tb_t* tb    Triple buffer
+ * @return void* Frame owned by the writer until rb_tb_publish(); NULL if tb is NULL
+ * @details The frame content is whatever was there before, not the last published frame
+ */
+void *rb_tb_write_buf(rb_tb_t *tb);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Publish the frame returned by rb_tb_write_buf() (writer side)
+ * @param rb_tb_t* tb    Triple buffer
+ * @return int RB_OK, or RB_PARAM_ERROR if tb is NULL
+ * @details If the reader did not take the previously published frame, that frame is simply overwritten
+ *          later: the reader only ever wants the freshest one
+ */
+int rb_tb_publish(rb_tb_t *tb);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get the most recent complete frame (reader side)
+ * @param rb_tb_t* tb    Triple buffer
+ * @param const void** frame Output: the frame, valid until the next call
+ * @return int RB_OK if a new frame was published since the last call, RB_EMPTY if not (the frame is the same
+ *         as the last time), RB_PARAM_ERROR on invalid input
+ */
+int rb_tb_read(rb_tb_t *tb, const void **frame);
+
+#endif // RING_BUF_TB_H
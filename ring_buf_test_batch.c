@@ -0,0 +1,154 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_batch.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: adaptive producer batching vs a tail update per record.
+ * Load: the producer pushes NUM_MESSAGES integers as fast as it can, the consumer validates the order.
+ * Quiet: the producer pushes PACED_MESSAGES timestamps, one every PACE_NS, and the consumer measures how long
+ * every record waited; the adaptive producer must not add latency there.
+ */
+
+#define NUM_MESSAGES 40000000
+#define PACED_MESSAGES 20000
+#define PACE_NS 20000
+#define RING_CELLS 4096
+/* Spin that many times before yielding the CPU */
+#define SPIN_LOOPS 10000
+
+ring_buf_t *ring = NULL;
+int64_t expected = 0;        /* Number of records the consumer pulls */
+int paced = 0;               /* 1: the records are timestamps, measure the latency */
+uint64_t latency_sum = 0;
+uint64_t latency_max = 0;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer thread: pulls the records, validates the order or measures the latency
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *consumer(void *arg)
+{
+    (void)arg;
+    set_my_cpu(1);
+
+    latency_sum = 0;
+    latency_max = 0;
+
+    for (int64_t i = 0; i < expected; i++) {
+        int64_t value;
+
+        for (int spin = 0; RB_OK != rb_pull_int(ring, &value); spin++) {
+            if (spin > SPIN_LOOPS) sched_yield();
+        }
+
+        if (paced) {
+            uint64_t delay = get_time_ns() - (uint64_t)value;
+
+            latency_sum += delay;
+            if (delay > latency_max) latency_max = delay;
+        } else if (value != i) {
+            printf("Expected payload %ld but it is %ld\n", (long)i, (long)value);
+            abort();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Push one record, directly or through the adaptive producer
+ * @param rb_batch_t* b     Adaptive producer; NULL to use rb_push_int()
+ * @param int64_t value Value
+ */
+static void push(rb_batch_t *b, int64_t value)
+{
+    for (int spin = 0; RB_OK != (b ? rb_batch_push_int(b, value) : rb_push_int(ring, value)); spin++) {
+        if (spin > SPIN_LOOPS) sched_yield();
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Run the load and the quiet tests
+ * @param rb_batch_t* b     Adaptive producer; NULL to use rb_push_int()
+ */
+void run(rb_batch_t *b)
+{
+    const char *name = b ? "adaptive" : "direct";
+    pthread_t thread;
+
+    paced = 0;
+    expected = NUM_MESSAGES;
+    uint64_t start_ns = get_time_ns();
+
+    pthread_create(&thread, NULL, consumer, NULL);
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        push(b, i);
+    }
+    if (b) rb_batch_flush(b);
+    pthread_join(thread, NULL);
+
+    double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+    printf("%-8s load : %'f messages/sec", name, NUM_MESSAGES / elapsed_sec);
+    if (b) printf(", %'lu records per publish", (unsigned long)(b->records / b->publishes));
+    printf("\n");
+
+    paced = 1;
+    expected = PACED_MESSAGES;
+    pthread_create(&thread, NULL, consumer, NULL);
+    for (int64_t i = 0; i < PACED_MESSAGES; i++) {
+        uint64_t next_ns = get_time_ns() + PACE_NS;
+
+        push(b, (int64_t)get_time_ns());
+        while (get_time_ns() < next_ns) {
+            if (b) rb_batch_poll(b);
+            sched_yield();
+        }
+    }
+    if (b) rb_batch_flush(b);
+    pthread_join(thread, NULL);
+
+    printf("%-8s quiet: latency avg %'lu ns, max %'lu ns\n", name, (unsigned long)(latency_sum / PACED_MESSAGES),
+           (unsigned long)latency_max);
+}
+
+int main(void)
+{
+    rb_batch_t b;
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    ring = rb_alloc_init(RING_CELLS, 1024 * 1024);
+    if (NULL == ring) {
+        fprintf(stderr, "Failed to initialize ring_buf_t.\n");
+        return EXIT_FAILURE;
+    }
+
+    set_my_cpu(0);
+
+    run(NULL);
+
+    if (RB_OK != rb_batch_init(&b, ring, 0, 0)) {
+        fprintf(stderr, "Failed to initialize rb_batch_t.\n");
+        return EXIT_FAILURE;
+    }
+    run(&b);
+    printf("adaptive: %'lu publishes, %'lu by the time budget, final threshold %u\n", (unsigned long)b.publishes,
+           (unsigned long)b.timeouts, b.threshold);
+
+    rb_destroy(ring);
+    return EXIT_SUCCESS;
+}
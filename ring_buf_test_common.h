@@ -0,0 +1,42 @@
+#ifndef RING_BUF_TEST_COMMON_H
+#define RING_BUF_TEST_COMMON_H
+
+/* Helpers shared by the ring_buf_test_*.c benchmark programs. Define _GNU_SOURCE before including it. */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+#include <sched.h>         // For CPU affinity
+#include <pthread.h>
+#include <unistd.h>      // Required for sysconf()
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get current time in nanoseconds
+ * @return uint64_t Current time in nanoseconds
+ */
+static inline uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Moves the caller thread to asked CPU
+ * @param int num   CPU number; the online CPU count is applied as modulo
+ */
+static inline void set_my_cpu(int num)
+{
+    cpu_set_t cpuset;
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    CPU_ZERO(&cpuset);
+    CPU_SET(num % (num_cpus > 0 ? num_cpus : 1), &cpuset);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0) {
+        perror("pthread_setaffinity_np () failed");
+    }
+}
+
+#endif // RING_BUF_TEST_COMMON_H
@@ -0,0 +1,222 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_cq.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Stress test of the conflating queue: a producer updates NUM_KEYS keys, most updates going to a few hot keys,
+ * and yields every PAUSE_EVERY updates, while a consumer polls. The consumer checks that:
+ * 1. No key is in the dirty keys ring twice: the ring between head and tail is scanned before every poll.
+ * 2. No value is torn: every word of a value is derived from its key and version.
+ * 3. The versions of a key never go back, and the last version the producer wrote for every key is the one the
+ *    consumer sees last.
+ */
+
+#define NUM_UPDATES 10000000
+#define NUM_KEYS 64
+#define HOT_KEYS 8
+#define PAUSE_EVERY 256
+#define VALUE_WORDS 8
+
+/**
+ * @struct
+ * @brief Value of a key; check words are derived from the key and the version, so a torn value is detected
+ */
+typedef struct {
+    uint64_t key;
+    uint64_t version;
+    uint64_t check[VALUE_WORDS - 2];
+} value_t;
+
+/* The queue under test, shared between threads */
+rb_cq_t *cq = NULL;
+/* Last version written for every key; read by the consumer after done */
+uint64_t last_written[NUM_KEYS];
+/* Set by the producer after the last update */
+int done = 0;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Fill a value of the given key and version
+ * @param value_t* v     Value to fill
+ * @param uint64_t key   Key
+ * @param uint64_t version Version
+ */
+static void value_fill(value_t *v, uint64_t key, uint64_t version)
+{
+    v->key = key;
+    v->version = version;
+    for (int i = 0; i < VALUE_WORDS - 2; i++) v->check[i] = (version * 0x9E3779B97F4A7C15ULL) ^ (key << 8) ^ i;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Check that the value is not torn
+ * @param const value_t* v     Value to check
+ * @return int 1 if every word matches the key and the version, 0 otherwise
+ */
+static int value_valid(const value_t *v)
+{
+    value_t expected;
+
+    value_fill(&expected, v->key, v->version);
+    return 0 == memcmp(v, &expected, sizeof(expected));
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Check that no key is queued twice: scan the dirty keys ring between head and tail (consumer side)
+ * @param ring_buf_t* keys  Dirty keys ring
+ * @return int 1 if every queued key is unique, 0 otherwise
+ */
+static int keys_unique(ring_buf_t *keys)
+{
+    uint8_t seen[NUM_KEYS] = {0};
+    uint64_t head = atomic_load_explicit(&keys->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&keys->tail, memory_order_acquire);
+
+    for (uint64_t i = head; i != tail; i++) {
+        int64_t key = keys->cells[i & (keys->capacity - 1)].idata;
+        if (key < 0 || key >= NUM_KEYS || seen[key]) return 0;
+        seen[key] = 1;
+    }
+
+    return 1;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer thread: NUM_UPDATES updates, 3 of 4 to HOT_KEYS keys
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *producer(__attribute__((unused))void *arg)
+{
+    uint64_t x = 88172645463325252ULL;
+
+    set_my_cpu(0);
+
+    for (uint64_t i = 0; i < NUM_UPDATES; i++) {
+        value_t v;
+
+        /* xorshift64 */
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+
+        uint32_t key = (x & 3) ? (x >> 8) % HOT_KEYS : (x >> 8) % NUM_KEYS;
+        value_fill(&v, key, ++last_written[key]);
+
+        if (RB_OK != rb_cq_update(cq, key, &v)) {
+            printf("Producer: rb_cq_update() failed at update %lu\n", i);
+            abort();
+        }
+
+        if (0 == i % PAUSE_EVERY) sched_yield();
+    }
+
+    atomic_store_explicit(&done, 1, memory_order_release);
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer thread: polls until the producer is done and the queue is drained, validates every value
+ * @param void* arg   Pointer to uint64_t, receives the number of polled values
+ * @return void* Ignored
+ */
+void *consumer(void *arg)
+{
+    uint64_t *polled = arg;
+    uint64_t last_seen[NUM_KEYS] = {0};
+
+    set_my_cpu(1);
+
+    for (;;) {
+        int finished = atomic_load_explicit(&done, memory_order_acquire);
+        uint32_t key;
+        value_t v;
+
+        if (!keys_unique(cq->keys)) {
+            printf("Consumer: a key is queued twice\n");
+            abort();
+        }
+
+        int rc = rb_cq_poll(cq, &key, &v);
+        if (RB_EMPTY == rc) {
+            /* Every update was queued before done was set */
+            if (finished) break;
+            sched_yield();
+            continue;
+        }
+
+        if (RB_OK != rc) {
+            printf("Consumer: rb_cq_poll() failed with %d\n", rc);
+            abort();
+        }
+
+        if (!value_valid(&v) || v.key != key) {
+            printf("Consumer: torn value of key %u: key %lu, version %lu\n", key, v.key, v.version);
+            abort();
+        }
+
+        if (v.version < last_seen[key]) {
+            printf("Consumer: key %u went back from version %lu to %lu\n", key, last_seen[key], v.version);
+            abort();
+        }
+
+        last_seen[key] = v.version;
+        (*polled)++;
+    }
+
+    for (int k = 0; k < NUM_KEYS; k++) {
+        if (last_seen[k] != last_written[k]) {
+            printf("Consumer: key %d ended at version %lu, the last written is %lu\n", k, last_seen[k],
+                   last_written[k]);
+            abort();
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    pthread_t prod_thread, cons_thread;
+    uint64_t polled = 0;
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    cq = rb_cq_alloc_init(NUM_KEYS, sizeof(value_t), 64 * 1024 * 1024);
+    if (NULL == cq) {
+        fprintf(stderr, "Failed to initialize the conflating queue.\n");
+        return EXIT_FAILURE;
+    }
+
+    uint64_t start_ns = get_time_ns();
+
+    pthread_create(&prod_thread, NULL, producer, NULL);
+    pthread_create(&cons_thread, NULL, consumer, &polled);
+    pthread_join(prod_thread, NULL);
+    pthread_join(cons_thread, NULL);
+
+    double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+
+    printf("conflating queue %d keys: %.6f seconds, %'f updates/sec\n", NUM_KEYS, elapsed_sec,
+           NUM_UPDATES / elapsed_sec);
+    printf("updates %'lu, conflated %'lu, polled %'lu; no key queued twice, no torn value, last values seen\n",
+           cq->updates, cq->conflated, polled);
+
+    rb_cq_destroy(cq);
+    return EXIT_SUCCESS;
+}
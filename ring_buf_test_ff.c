@@ -0,0 +1,176 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_ff.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: FastForward-style ring (sequence word in every slot) against ring_buf_t.
+ * 1. Latency: ping-pong over two rings, the round trip time is measured.
+ * 2. Throughput: one producer, one consumer.
+ */
+
+#define NUM_MESSAGES 50000000
+#define NUM_ROUND_TRIPS 200000
+#define RING_CELLS 4096
+/* Spin that many times on an empty / full ring before yielding the CPU */
+#define SPIN_LOOPS 10000
+
+typedef int (*push_fn_t)(void *ring, int64_t idata);
+typedef int (*pull_fn_t)(void *ring, int64_t *idata);
+
+/* Rings under test: ping goes to the echo thread, pong comes back */
+void *ping = NULL;
+void *pong = NULL;
+push_fn_t push_fn = NULL;
+pull_fn_t pull_fn = NULL;
+
+static int push_rb(void *r, int64_t idata) { return rb_push_int(r, idata); }
+static int pull_rb(void *r, int64_t *idata) { return rb_pull_int(r, idata); }
+static int push_ff(void *r, int64_t idata) { return rb_ff_push_int(r, idata); }
+static int pull_ff(void *r, int64_t *idata) { return rb_ff_pull_int(r, idata); }
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Push, spin then yield while the ring is full
+ * @param void* ring  Ring
+ * @param int64_t idata Value to push
+ */
+static inline void do_push(void *ring, int64_t idata)
+{
+    for (int i = 0; RB_OK != push_fn(ring, idata); i++) {
+        if (i > SPIN_LOOPS) sched_yield();
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull, spin then yield while the ring is empty
+ * @param void* ring  Ring
+ * @return int64_t Pulled value
+ */
+static inline int64_t do_pull(void *ring)
+{
+    int64_t idata;
+
+    for (int i = 0; RB_OK != pull_fn(ring, &idata); i++) {
+        if (i > SPIN_LOOPS) sched_yield();
+    }
+
+    return idata;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Echo thread: returns every ping as a pong
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *echo(__attribute__((unused))void *arg)
+{
+    set_my_cpu(1);
+
+    for (int64_t i = 0; i < NUM_ROUND_TRIPS; i++) {
+        do_push(pong, do_pull(ping));
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer thread: reads NUM_MESSAGES integers and validates the order
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *consumer(__attribute__((unused))void *arg)
+{
+    set_my_cpu(1);
+
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        int64_t idata = do_pull(ping);
+
+        if (idata != i) {
+            printf("Expected payload %ld but it is %ld\n", i, idata);
+            abort();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Measure the round trip latency and the throughput of one ring layout
+ * @param const char* name  Layout name to print
+ */
+void run(const char *name)
+{
+    pthread_t thread;
+
+    set_my_cpu(0);
+
+    /* Latency */
+    pthread_create(&thread, NULL, echo, NULL);
+    uint64_t start_ns = get_time_ns();
+    for (int64_t i = 0; i < NUM_ROUND_TRIPS; i++) {
+        do_push(ping, i);
+        if (do_pull(pong) != i) {
+            printf("Expected pong %ld\n", i);
+            abort();
+        }
+    }
+    uint64_t rtt_ns = get_time_ns() - start_ns;
+    pthread_join(thread, NULL);
+
+    /* Throughput */
+    pthread_create(&thread, NULL, consumer, NULL);
+    start_ns = get_time_ns();
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        do_push(ping, i);
+    }
+    pthread_join(thread, NULL);
+    double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+
+    printf("%-14s round trip: %9.1f ns, throughput: %'f messages/sec\n",
+           name, (double)rtt_ns / NUM_ROUND_TRIPS, NUM_MESSAGES / elapsed_sec);
+}
+
+int main(void)
+{
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    ping = rb_alloc_init(RING_CELLS, 1024 * 1024);
+    pong = rb_alloc_init(RING_CELLS, 1024 * 1024);
+    if (NULL == ping || NULL == pong) {
+        fprintf(stderr, "Failed to initialize ring_buf.\n");
+        return EXIT_FAILURE;
+    }
+    push_fn = push_rb;
+    pull_fn = pull_rb;
+    run("ring_buf_t");
+    rb_destroy(ping);
+    rb_destroy(pong);
+
+    ping = rb_ff_alloc_init(RING_CELLS, 1024 * 1024);
+    pong = rb_ff_alloc_init(RING_CELLS, 1024 * 1024);
+    if (NULL == ping || NULL == pong) {
+        fprintf(stderr, "Failed to initialize rb_ff_t.\n");
+        return EXIT_FAILURE;
+    }
+    push_fn = push_ff;
+    pull_fn = pull_ff;
+    run("rb_ff_t");
+    rb_ff_destroy(ping);
+    rb_ff_destroy(pong);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,94 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <locale.h>
+
+#include "ring_buf.h"
+#include "ring_buf_mem.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: Ring Buffer startup time for every initialization mode.
+ * For each mode NUM_RINGS rings are created; the creation time, the resident memory right after the creation
+ * and the time of the first pass of the producer over the whole ring (where the lazy mode pays) are printed.
+ * Every ring is several RB_INIT_PARALLEL_CHUNK large, so the parallel mode splits it between threads as long as
+ * there are enough online CPUs.
+ */
+
+#define NUM_RINGS 4
+#define RING_CELLS (4 * 1024 * 1024)
+#define MAX_ALLOC (1024UL * 1024 * 1024)
+
+_Static_assert(RING_CELLS * sizeof(cell_t) >= 4 * RB_INIT_PARALLEL_CHUNK, "the ring must span several chunks");
+
+/* -1 stands for the legacy rb_alloc_init() */
+#define MODE_LEGACY (-1)
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Create NUM_RINGS rings with the given mode and print the measurements
+ * @param const char* name  Mode name to print
+ * @param int mode  RB_INIT_* mode or MODE_LEGACY
+ */
+void run_mode(const char *name, int mode)
+{
+    ring_buf_t *rings[NUM_RINGS];
+    size_t resident = 0, reserved = 0;
+
+    uint64_t start_ns = get_time_ns();
+    for (int i = 0; i < NUM_RINGS; i++) {
+        rings[i] = MODE_LEGACY == mode ? rb_alloc_init(RING_CELLS, MAX_ALLOC) :
+                   rb_alloc_init_mode(RING_CELLS, MAX_ALLOC, mode);
+        if (NULL == rings[i]) {
+            printf("%-20s failed to create ring %d\n", name, i);
+            for (int j = 0; j < i; j++) rb_destroy(rings[j]);
+            return;
+        }
+    }
+    uint64_t init_ns = get_time_ns() - start_ns;
+
+    for (int i = 0; i < NUM_RINGS; i++) {
+        size_t r, v;
+        if (RB_OK == rb_mem_usage(rings[i], &r, &v)) {
+            resident += r;
+            reserved += v;
+        }
+    }
+
+    /* The first pass over the whole ring: the producer reaches every page once */
+    start_ns = get_time_ns();
+    for (int i = 0; i < NUM_RINGS; i++) {
+        int64_t idata;
+        for (int64_t n = 0; n < RING_CELLS - 1; n++) rb_push_int(rings[i], n);
+        for (int64_t n = 0; n < RING_CELLS - 1; n++) rb_pull_int(rings[i], &idata);
+    }
+    uint64_t pass_ns = get_time_ns() - start_ns;
+
+    printf("%-20s init: %9.3f ms, resident after init: %'12zu of %'12zu bytes, first pass: %9.3f ms\n",
+           name, init_ns / 1e6, resident, reserved, pass_ns / 1e6);
+
+    for (int i = 0; i < NUM_RINGS; i++) rb_destroy(rings[i]);
+}
+
+int main(void)
+{
+    size_t chunks = rb_mem_size(RING_CELLS) / RB_INIT_PARALLEL_CHUNK;
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    printf("ring: %'zu bytes, parallel pre-fault threads: %zu\n", rb_mem_size(RING_CELLS),
+           num_cpus > 0 && (size_t)num_cpus < chunks ? (size_t)num_cpus : chunks);
+
+    run_mode("legacy", MODE_LEGACY);
+    run_mode("touch", RB_INIT_TOUCH);
+    run_mode("lazy", RB_INIT_LAZY);
+    run_mode("populate", RB_INIT_POPULATE);
+    run_mode("parallel", RB_INIT_PARALLEL);
+    run_mode("populate + mlock", RB_INIT_POPULATE | RB_INIT_MLOCK);
+
+    return EXIT_SUCCESS;
+}
@@ -10,8 +10,9 @@
 #include <string.h>
 
 #include "ring_buf.h"
+#include "ring_buf_proc.h"
 
-/* This variable is used in helper functions fo_push() / do_pull() "*/
+/* This variable is used in helper function fo_push() "*/
 const int loops_waiting = 10000;
 #define NUM_MESSAGES 500000000
 size_t arr_size = 4096 * 2;
@@ -23,7 +24,6 @@ int cpu_cons = 1;
 
 /* Used to calculate number of "hard" misses, when the sched_yield() was called */
 int miss_push = 0;
-int miss_pull = 0;
 
 /* The Ring Buffer structure, shared between threads. */
 ring_buf_t *ring_buf = NULL;  // Shared ring buffer buffer
@@ -75,38 +75,6 @@ inline int do_push(ring_buf_t *ring_buf, int64_t idata)
 }
 
 
-__attribute__((hot))
-/**
- * @author Sebastian Mountaniol (04/03/2025)
- * @brief Pull integer value from the Ring Buffer
- * @param ring_buf_t* ring_buf Pointer to the Ring Buffer strcuture
- * @param int64_t* idata   Return value extracted from the Ring Buffer
- * @return int RB_EMPTY if the Ring buffer is empty, RB_OK if an integer value extracted
- */
-inline int do_pull(ring_buf_t *ring_buf, int64_t *idata)
-{
-    int rc = RB_EMPTY;
-
-    for (int i = 0; i < loops_waiting; i++) {
-        rc = rb_pull_int(ring_buf, idata);
-        if (RB_OK == rc) {
-            return RB_OK;
-        }
-    }
-
-    int cnt = 0;
-    do {
-        cnt++;
-        rc = rb_pull_int(ring_buf, idata);
-        if (rc != RB_OK) {
-            miss_pull++;
-        }
-        sched_yield();
-    } while (rc != RB_OK);
-
-    return rc;
-}
-
 /**
  * @author Sebastian Mountaniol (04/03/2025)
  * @brief Moves the caller thread to asked CPU
@@ -174,6 +142,26 @@ void *producer(__attribute__((unused))void *arg)
     return NULL;
 }
 
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Event handler of the consumer: validates every integer, stops after the last one
+ * @param cell_t* cell  The record
+ * @param uint64_t seq   Sequence of the record; the producer pushes the sequence numbers
+ * @param int end_of_batch Ignored
+ * @param void* ctx   The batch event processor
+ */
+static void on_event(cell_t *cell, uint64_t seq, __attribute__((unused))int end_of_batch, void *ctx)
+{
+    if (cell->idata != (int64_t)seq) {
+        printf("Expected payload %ld but it is %ld\n", (int64_t)seq, cell->idata);
+        abort();
+    }
+
+    if (NUM_MESSAGES - 1 == seq) {
+        rb_proc_stop(ctx);
+    }
+}
+
 /* Consumer Thread: Receives NUM_MESSAGES messages */
 /**
  * @author Sebastian Mountaniol (04/03/2025)
@@ -184,27 +172,22 @@ void *producer(__attribute__((unused))void *arg)
  */
 void *consumer(__attribute__((unused))void *arg)
 {
+    rb_proc_t proc;
+
     set_my_cpu(cpu_cons);
     set_my_prio();
 
-    uint64_t start_ns = get_time_ns(); // Start time
+    rb_proc_init(&proc, ring_buf, on_event, &proc);
 
-    for (long i = 0; i < NUM_MESSAGES; i++) {
-        int64_t idata;
-
-        do_pull(ring_buf, &idata);
+    uint64_t start_ns = get_time_ns(); // Start time
 
-        if (idata != i) {
-            printf("Expected payload %ld but it is %ld\n", i, idata);
-            abort();
-        }
-    }
+    rb_proc_run(&proc);
 
     uint64_t end_ns = get_time_ns(); // End time
     double elapsed_sec = (end_ns - start_ns) / 1e9;
     double throughput = NUM_MESSAGES / elapsed_sec;
 
-    printf("Consumer finished in %.6f seconds, missses: %d\n", elapsed_sec, miss_pull);
+    printf("Consumer finished in %.6f seconds, batches: %lu, sleeps: %lu\n", elapsed_sec, proc.batches, proc.sleeps);
     printf("Throughput: %'f messages/sec\n", throughput);
     return NULL;
 }
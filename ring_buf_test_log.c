@@ -0,0 +1,87 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+#include <fcntl.h>
+
+#include "ring_buf.h"
+#include "ring_buf_log.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: the hot path cost of one log call.
+ * 1. snprintf() of the line on the calling thread, as the hot thread does today.
+ * 2. rb_log(): the format id and the raw arguments go into the thread ring, the background thread formats them
+ *    and writes them into /dev/null. Records are logged in bursts of half a ring, and only the bursts are
+ *    timed: the producer waits for the background thread between the bursts, so the hot path never drops.
+ */
+
+#define RING_CELLS 4096
+#define BURST (RING_CELLS / 2)
+#define NUM_RECORDS (1024 * BURST)
+#define LOG_FORMAT "order %d of %s: price %.2f, qty %zu, id %llx"
+
+int main(void)
+{
+    char line[RB_LOG_LINE_MAX];
+    volatile size_t sink = 0;
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+    set_my_cpu(0);
+
+    /* snprintf() on the hot thread */
+    uint64_t start_ns = get_time_ns();
+    for (int i = 0; i < NUM_RECORDS; i++) {
+        sink += snprintf(line, sizeof(line), LOG_FORMAT, i, "BUY", i * 0.25, (size_t)i * 10, (unsigned long long)i);
+    }
+    double snprintf_ns = (double)(get_time_ns() - start_ns) / NUM_RECORDS;
+
+    /* rb_log() */
+    int fd = open("/dev/null", O_WRONLY);
+    rb_logger_t *lg = rb_log_alloc_init(fd);
+    if (NULL == lg) {
+        fprintf(stderr, "Failed to initialize rb_logger_t.\n");
+        return EXIT_FAILURE;
+    }
+
+    int fmt_id = rb_log_register(lg, LOG_FORMAT);
+    rb_log_thread_t *t = rb_log_attach(lg, RING_CELLS);
+    if (fmt_id < 0 || NULL == t || RB_OK != rb_log_start(lg)) {
+        fprintf(stderr, "Failed to start the logger.\n");
+        return EXIT_FAILURE;
+    }
+
+    uint64_t records, bytes, dropped;
+    uint64_t burst_ns = 0;
+
+    for (int i = 0; i < NUM_RECORDS;) {
+        start_ns = get_time_ns();
+        for (int end = i + BURST; i < end; i++) {
+            rb_log(t, fmt_id, i, "BUY", i * 0.25, (size_t)i * 10, (unsigned long long)i);
+        }
+        burst_ns += get_time_ns() - start_ns;
+
+        /* Let the background thread drain the ring */
+        do {
+            usleep(1000);
+            rb_log_get_stats(lg, &records, &bytes, &dropped);
+        } while (records + dropped < (uint64_t)i);
+    }
+    double rb_log_ns = (double)burst_ns / NUM_RECORDS;
+
+    rb_log_stop(lg);
+    rb_log_get_stats(lg, &records, &bytes, &dropped);
+    rb_log_destroy(lg);
+    close(fd);
+
+    printf("snprintf: %8.1f ns per call\n", snprintf_ns);
+    printf("rb_log:   %8.1f ns per call, written %'lu records (%'lu bytes), dropped %'lu\n",
+           rb_log_ns, records, bytes, dropped);
+
+    return EXIT_SUCCESS;
+}
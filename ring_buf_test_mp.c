@@ -0,0 +1,137 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_mp.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: multi-producer ring with the sequencer.
+ * 1..MAX_PRODUCERS producers push NUM_MESSAGES integers in total, one consumer drains them with
+ * rb_mp_poll() / rb_mp_consume() and validates the per-producer order.
+ * Every producer count is run with single pushes (CAS claim) and with batch claims (one fetch_add per batch).
+ */
+
+#define NUM_MESSAGES 40000000
+#define RING_CELLS 4096
+#define MAX_PRODUCERS 4
+#define BATCH 16
+/* Spin that many times on a full ring before yielding the CPU */
+#define SPIN_LOOPS 10000
+/* The producer id is kept in the upper bits of every value */
+#define ID_SHIFT 48
+#define ID_MASK ((INT64_C(1) << ID_SHIFT) - 1)
+
+rb_mp_t *ring = NULL;
+int num_producers = 1;
+size_t batch = 1;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer thread: pushes its share of NUM_MESSAGES integers
+ * @param void* arg   Producer id
+ * @return void* Ignored
+ */
+void *producer(void *arg)
+{
+    int64_t id = (int64_t)(intptr_t)arg;
+    int64_t count = NUM_MESSAGES / num_producers;
+
+    set_my_cpu(1 + id);
+
+    if (1 == batch) {
+        for (int64_t i = 0; i < count; i++) {
+            for (int spin = 0; RB_OK != rb_mp_push_int(ring, (id << ID_SHIFT) | i); spin++) {
+                if (spin > SPIN_LOOPS) sched_yield();
+            }
+        }
+        return NULL;
+    }
+
+    for (int64_t i = 0; i < count; i += batch) {
+        uint64_t seq = 0;
+
+        rb_mp_claim(ring, batch, &seq);
+        for (size_t j = 0; j < batch; j++) {
+            rb_mp_cell(ring, seq + j)->idata = (id << ID_SHIFT) | (i + j);
+        }
+        rb_mp_publish(ring, seq, batch);
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consume everything the producers push, validate the order of every producer
+ */
+void consume(void)
+{
+    int64_t next[MAX_PRODUCERS] = {0};
+    int64_t total = (NUM_MESSAGES / num_producers) * num_producers;
+
+    for (int64_t received = 0; received < total;) {
+        uint64_t seq;
+        size_t count;
+
+        for (int spin = 0; 0 == (count = rb_mp_poll(ring, &seq)); spin++) {
+            if (spin > SPIN_LOOPS) sched_yield();
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            int64_t idata = rb_mp_cell(ring, seq + i)->idata;
+            int64_t id = idata >> ID_SHIFT;
+
+            if ((idata & ID_MASK) != next[id]) {
+                printf("Producer %ld: expected payload %ld but it is %ld\n", id, next[id], idata & ID_MASK);
+                abort();
+            }
+            next[id]++;
+        }
+
+        rb_mp_consume(ring, count);
+        received += count;
+    }
+}
+
+int main(void)
+{
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    ring = rb_mp_alloc_init(RING_CELLS, 1024 * 1024);
+    if (NULL == ring) {
+        fprintf(stderr, "Failed to initialize rb_mp_t.\n");
+        return EXIT_FAILURE;
+    }
+
+    set_my_cpu(0);
+
+    for (num_producers = 1; num_producers <= MAX_PRODUCERS; num_producers *= 2) {
+        for (batch = 1; batch <= BATCH; batch *= BATCH) {
+            pthread_t threads[MAX_PRODUCERS];
+            uint64_t start_ns = get_time_ns();
+
+            for (int i = 0; i < num_producers; i++) {
+                pthread_create(&threads[i], NULL, producer, (void *)(intptr_t)i);
+            }
+            consume();
+            for (int i = 0; i < num_producers; i++) {
+                pthread_join(threads[i], NULL);
+            }
+
+            double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+            printf("%d producer(s), batch %2zu: %'f messages/sec\n", num_producers, batch,
+                   NUM_MESSAGES / elapsed_sec);
+        }
+    }
+
+    rb_mp_destroy(ring);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_ops.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: consumer cost of filter -> map -> sum/min/max over the integer ring.
+ * 1. Per-element loop: rb_pull_int() and scalar code, like consumer() in ring_buf_test_int.c.
+ * 2. rb_ops_run(): the same pipeline over contiguous spans of the ring.
+ * The ring is filled before every round (not timed), then drained (timed), so only the consumer is measured.
+ */
+
+#define RING_CELLS 8192
+#define NUM_ROUNDS 20000
+#define FILTER_LO -250
+#define FILTER_HI 250
+#define MAP_MUL 3
+#define MAP_ADD 1
+
+ring_buf_t *ring = NULL;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Fill the ring with pseudo-random values in [-500, 500)
+ * @param uint64_t* seed  Generator state
+ */
+static void fill(uint64_t *seed)
+{
+    for (;;) {
+        *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        if (RB_OK != rb_push_int(ring, (int64_t)((*seed >> 33) % 1000) - 500)) break;
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Drain the ring one element at a time
+ * @param rb_ops_agg_t* agg   Aggregate to update
+ */
+static void drain_scalar(rb_ops_agg_t *agg)
+{
+    int64_t x;
+
+    while (RB_OK == rb_pull_int(ring, &x)) {
+        if (x < FILTER_LO || x > FILTER_HI) continue;
+        x = x * MAP_MUL + MAP_ADD;
+        agg->sum += x;
+        if (x < agg->min) agg->min = x;
+        if (x > agg->max) agg->max = x;
+        agg->count++;
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Run all the rounds with one drain method
+ * @param int use_ops 1: rb_ops_run(), 0: the per-element loop
+ * @param rb_ops_agg_t* agg   Output aggregate
+ * @return double Drained records per second
+ */
+static double run(int use_ops, rb_ops_agg_t *agg)
+{
+    const rb_ops_stage_t stages[] = {
+        { .op = RB_OPS_FILTER, .a = FILTER_LO, .b = FILTER_HI },
+        { .op = RB_OPS_MAP, .a = MAP_MUL, .b = MAP_ADD },
+    };
+    uint64_t seed = 42;
+    uint64_t elapsed_ns = 0;
+    uint64_t records = 0;
+
+    rb_ops_agg_init(agg);
+
+    for (int round = 0; round < NUM_ROUNDS; round++) {
+        fill(&seed);
+        records += RING_CELLS - 1;
+
+        uint64_t start_ns = get_time_ns();
+        if (use_ops) {
+            while (rb_ops_run(ring, stages, 2, agg, 0)) {
+            }
+        } else {
+            drain_scalar(agg);
+        }
+        elapsed_ns += get_time_ns() - start_ns;
+    }
+
+    return records / (elapsed_ns / 1e9);
+}
+
+int main(void)
+{
+    rb_ops_agg_t scalar, ops;
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+    set_my_cpu(0);
+
+    ring = rb_alloc_init(RING_CELLS, 1024 * 1024);
+    if (NULL == ring) {
+        fprintf(stderr, "Failed to initialize ring_buf.\n");
+        return EXIT_FAILURE;
+    }
+
+    double scalar_rate = run(0, &scalar);
+    double ops_rate = run(1, &ops);
+
+    if (scalar.sum != ops.sum || scalar.min != ops.min || scalar.max != ops.max || scalar.count != ops.count) {
+        printf("Results differ: sum %ld / %ld, count %lu / %lu\n", scalar.sum, ops.sum, scalar.count, ops.count);
+        abort();
+    }
+
+    printf("per-element: %'f records/sec\n", scalar_rate);
+    printf("rb_ops_run:  %'f records/sec\n", ops_rate);
+    printf("kept %'lu records, sum %ld, min %ld, max %ld\n", ops.count, ops.sum, ops.min, ops.max);
+
+    rb_destroy(ring);
+    return EXIT_SUCCESS;
+}
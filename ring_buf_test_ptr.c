@@ -0,0 +1,184 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: pointer ring with real 64..1024 byte payloads.
+ * The producer writes every payload before pushing its pointer, the consumer reads the whole payload. The
+ * consumer pulls with rb_pull_ptr(), rb_pull_ptr_prefetch() and rb_pull_ptr_batch().
+ */
+
+#define NUM_MESSAGES 10000000
+#define RING_CELLS 1024
+#define BATCH 64
+/* A payload buffer is reused only when the consumer is surely done with it */
+#define POOL_SIZE (RING_CELLS * 2)
+#define PREFETCH_DEPTH 8
+
+enum {
+    PULL_PLAIN,
+    PULL_PREFETCH,
+    PULL_BATCH,
+};
+
+ring_buf_t *ring_buf = NULL;
+char *pool = NULL;
+size_t payload_size = 64;
+int pull_mode = PULL_PLAIN;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer thread: fills payloads and pushes their pointers
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *producer(__attribute__((unused))void *arg)
+{
+    set_my_cpu(0);
+
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        char *payload = pool + (i % POOL_SIZE) * payload_size;
+
+        memset(payload, (int)(i & 0xff), payload_size);
+        memcpy(payload, &i, sizeof(i));
+
+        while (RB_OK != rb_push_ptr(ring_buf, payload, payload_size)) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read the whole payload and validate it
+ * @param int64_t expected Expected sequence number
+ * @param void* data  Payload
+ * @param size_t size  Payload size
+ * @return uint64_t Sum of the payload bytes
+ */
+static inline uint64_t consume(int64_t expected, void *data, size_t size)
+{
+    const unsigned char *p = data;
+    uint64_t sum = 0;
+    int64_t seq;
+
+    memcpy(&seq, p, sizeof(seq));
+    if (seq != expected || size != payload_size) {
+        printf("Expected payload %ld but it is %ld\n", expected, seq);
+        abort();
+    }
+
+    for (size_t i = 0; i < size; i++) sum += p[i];
+    return sum;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer thread: pulls pointers with the configured pull mode, reads the payloads
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *consumer(__attribute__((unused))void *arg)
+{
+    void *data[BATCH];
+    size_t sizes[BATCH];
+    uint64_t sum = 0;
+
+    set_my_cpu(1);
+
+    for (int64_t i = 0; i < NUM_MESSAGES;) {
+        size_t pulled = 0;
+        int rc;
+
+        data[0] = NULL;
+        sizes[0] = 0;
+
+        switch (pull_mode) {
+        case PULL_PLAIN:
+            rc = rb_pull_ptr(ring_buf, &data[0], &sizes[0]);
+            pulled = 1;
+            break;
+        case PULL_PREFETCH:
+            rc = rb_pull_ptr_prefetch(ring_buf, &data[0], &sizes[0], PREFETCH_DEPTH);
+            pulled = 1;
+            break;
+        default:
+            rc = rb_pull_ptr_batch(ring_buf, data, sizes, BATCH, &pulled);
+            break;
+        }
+
+        if (RB_OK != rc) {
+            sched_yield();
+            continue;
+        }
+
+        for (size_t n = 0; n < pulled; n++, i++) {
+            sum += consume(i, data[n], sizes[n]);
+        }
+    }
+
+    /* Keep the sum alive */
+    if (0 == sum) printf("Zero sum\n");
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Run one producer / consumer pass
+ * @param const char* name  Pull mode name to print
+ */
+void run(const char *name)
+{
+    pthread_t prod_thread, cons_thread;
+    uint64_t start_ns = get_time_ns();
+
+    pthread_create(&prod_thread, NULL, producer, NULL);
+    pthread_create(&cons_thread, NULL, consumer, NULL);
+    pthread_join(prod_thread, NULL);
+    pthread_join(cons_thread, NULL);
+
+    double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+    printf("payload %4zu bytes, %-10s %.6f seconds, %'f messages/sec\n",
+           payload_size, name, elapsed_sec, NUM_MESSAGES / elapsed_sec);
+}
+
+int main(void)
+{
+    static const size_t sizes[] = { 64, 256, 1024 };
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    ring_buf = rb_alloc_init(RING_CELLS, 1024 * 1024);
+    pool = aligned_alloc(64, POOL_SIZE * 1024);
+    if (NULL == ring_buf || NULL == pool) {
+        fprintf(stderr, "Failed to initialize ring_buf.\n");
+        return EXIT_FAILURE;
+    }
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        payload_size = sizes[s];
+
+        pull_mode = PULL_PLAIN;
+        run("plain");
+        pull_mode = PULL_PREFETCH;
+        run("prefetch");
+        pull_mode = PULL_BATCH;
+        run("batch");
+    }
+
+    free(pool);
+    rb_destroy(ring_buf);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,215 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_relay.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: direct cross-socket SPSC ring vs the batching relay.
+ * The producer runs on the first CPU of the first NUMA node, the consumer on the first CPU of the last node.
+ * Direct: one ring placed on the consumer node. Relay: a local ring on the producer node, the relay thread on
+ * another CPU of the producer node, a remote ring on the consumer node. Throughput: NUM_MESSAGES integers, order
+ * validated. Latency: PING_MESSAGES timestamps sent one at a time, the next one after the consumer received the
+ * previous one.
+ * On a single node machine all three threads run on the same node, on different CPUs when there are enough,
+ * and the numbers show the cost of the extra hop.
+ */
+
+#define NUM_MESSAGES 20000000
+#define PING_MESSAGES 20000
+#define RING_CELLS 4096
+#define MAX_ALLOC (16 * 1024 * 1024)
+/* Spin that many times before yielding the CPU */
+#define SPIN_LOOPS 10000
+
+ring_buf_t *in = NULL;       /* The producer pushes here */
+ring_buf_t *out = NULL;      /* The consumer pulls from here */
+int producer_cpu = 0;
+int consumer_cpu = 0;
+int64_t received = 0;        /* Latency test: messages received by the consumer */
+uint64_t latency_sum = 0;
+uint64_t latency_max = 0;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Push one value, spinning then yielding while the ring is full
+ * @param int64_t value Value
+ */
+static void push(int64_t value)
+{
+    for (int spin = 0; RB_OK != rb_push_int(in, value); spin++) {
+        if (spin > SPIN_LOOPS) sched_yield();
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull one value, spinning then yielding while the ring is empty
+ * @return int64_t Value
+ */
+static int64_t pull(void)
+{
+    int64_t value;
+
+    for (int spin = 0; RB_OK != rb_pull_int(out, &value); spin++) {
+        if (spin > SPIN_LOOPS) sched_yield();
+    }
+
+    return value;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Throughput consumer: pulls NUM_MESSAGES integers and validates the order
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *consumer(void *arg)
+{
+    (void)arg;
+    set_my_cpu(consumer_cpu);
+
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        int64_t value = pull();
+
+        if (value != i) {
+            printf("Expected payload %ld but it is %ld\n", (long)i, (long)value);
+            abort();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Latency consumer: pulls PING_MESSAGES timestamps, accumulates the delay of every one
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *ping_consumer(void *arg)
+{
+    (void)arg;
+    set_my_cpu(consumer_cpu);
+
+    for (int64_t i = 0; i < PING_MESSAGES; i++) {
+        uint64_t sent_ns = (uint64_t)pull();
+        uint64_t delay = get_time_ns() - sent_ns;
+
+        latency_sum += delay;
+        if (delay > latency_max) latency_max = delay;
+        atomic_store_explicit(&received, i + 1, memory_order_release);
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Run the throughput and the latency tests on the current in / out rings
+ * @param const char* name  Name printed in the report
+ */
+void run(const char *name)
+{
+    pthread_t thread;
+    uint64_t start_ns = get_time_ns();
+
+    pthread_create(&thread, NULL, consumer, NULL);
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        push(i);
+    }
+    pthread_join(thread, NULL);
+
+    double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+
+    latency_sum = 0;
+    latency_max = 0;
+    atomic_store(&received, 0);
+    pthread_create(&thread, NULL, ping_consumer, NULL);
+    for (int64_t i = 0; i < PING_MESSAGES; i++) {
+        push((int64_t)get_time_ns());
+        for (int spin = 0; atomic_load_explicit(&received, memory_order_acquire) <= i; spin++) {
+            if (spin > SPIN_LOOPS) sched_yield();
+        }
+    }
+    pthread_join(thread, NULL);
+
+    printf("%-7s: %'f messages/sec, latency avg %'lu ns, max %'lu ns\n", name, NUM_MESSAGES / elapsed_sec,
+           (unsigned long)(latency_sum / PING_MESSAGES), (unsigned long)latency_max);
+}
+
+int main(void)
+{
+    int nodes = rb_numa_num_nodes();
+    int producer_node = rb_numa_next_node(-1);
+    int consumer_node = producer_node;
+    int relay_cpu;
+    ring_buf_t *direct;
+    rb_relay_t *relay;
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    for (int node = producer_node; node >= 0; node = rb_numa_next_node(node)) {
+        consumer_node = node;
+    }
+
+    producer_cpu = rb_numa_first_cpu(producer_node);
+    if (producer_cpu < 0) {
+        fprintf(stderr, "Can not find the CPUs of the NUMA nodes.\n");
+        return EXIT_FAILURE;
+    }
+
+    /* The relay thread must run on the producer socket, on a CPU of its own */
+    if (consumer_node != producer_node) {
+        consumer_cpu = rb_numa_first_cpu(consumer_node);
+        relay_cpu = rb_numa_next_cpu(producer_node, producer_cpu);
+    } else {
+        consumer_cpu = rb_numa_next_cpu(producer_node, producer_cpu);
+        if (consumer_cpu < 0) consumer_cpu = producer_cpu;
+        relay_cpu = consumer_cpu != producer_cpu ? rb_numa_next_cpu(producer_node, consumer_cpu) : RB_PARAM_ERROR;
+    }
+
+    printf("%d NUMA node(s): producer on CPU %d (node %d), consumer on CPU %d (node %d)\n", nodes, producer_cpu,
+           producer_node, consumer_cpu, consumer_node);
+    if (relay_cpu < 0) {
+        printf("No free CPU on the producer node: the relay thread is not pinned\n");
+        relay_cpu = -1;
+    } else {
+        printf("relay thread on CPU %d (node %d)\n", relay_cpu, rb_numa_node_of_cpu(relay_cpu));
+    }
+
+    set_my_cpu(producer_cpu);
+
+    direct = rb_alloc_init_node(RING_CELLS, MAX_ALLOC, consumer_node);
+    if (NULL == direct) {
+        fprintf(stderr, "Failed to initialize ring_buf_t.\n");
+        return EXIT_FAILURE;
+    }
+    in = direct;
+    out = direct;
+    run("direct");
+    rb_destroy(direct);
+
+    relay = rb_relay_alloc_init(RING_CELLS, RING_CELLS, producer_node, consumer_node, 0, MAX_ALLOC);
+    if (NULL == relay || RB_OK != rb_relay_start(relay, relay_cpu)) {
+        fprintf(stderr, "Failed to initialize rb_relay_t.\n");
+        return EXIT_FAILURE;
+    }
+    in = relay->local;
+    out = relay->remote;
+    run("relay");
+    rb_relay_stop(relay);
+    printf("relay  : %'lu cells moved in %'lu batches, remote ring full %'lu times\n", (unsigned long)relay->moved,
+           (unsigned long)relay->batches, (unsigned long)relay->full);
+    rb_relay_destroy(relay);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,227 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_spill.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Stress test of the spilling ring: a tiny in-memory ring and a producer which pushes bursts of PAUSE_EVERY
+ * records, larger than the ring, and yields between them. The producer keeps switching into the spill mode and
+ * back while the consumer validates the sequence number, the size, the payload bytes and, for spilled records,
+ * the alignment of every record. Every LARGE_EVERY record is bigger than the batch buffers, so the direct file
+ * write is exercised too. A monitor thread reads the statistics meanwhile.
+ */
+
+#define NUM_MESSAGES 2000000
+#define TINY_CELLS 16
+#define BATCH_SIZE (4 * 1024)
+#define PAUSE_EVERY 256
+#define LARGE_EVERY 4099
+#define LARGE_SIZE (3 * BATCH_SIZE)
+#define SPILL_PATH "/tmp/ring_buf_test_spill.bin"
+
+/* The ring under test, shared between threads */
+rb_spill_t *spill = NULL;
+/* Set by the consumer when it is done, stops the monitor */
+int done = 0;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Payload size of the record with the given sequence number
+ * @param uint64_t seq   Sequence number
+ * @return size_t Payload size, at least sizeof(uint64_t)
+ */
+static size_t record_size(uint64_t seq)
+{
+    if (0 == seq % LARGE_EVERY) return LARGE_SIZE;
+    return sizeof(uint64_t) + (seq * 7) % 120;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Expected payload byte at the given offset of a record
+ * @param uint64_t seq   Sequence number
+ * @param size_t off   Offset, after the sequence number
+ * @return unsigned char The byte
+ */
+static inline unsigned char record_byte(uint64_t seq, size_t off)
+{
+    return (unsigned char)(seq + off);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer thread: pushes NUM_MESSAGES records of varying size
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *producer(__attribute__((unused))void *arg)
+{
+    set_my_cpu(0);
+
+    for (uint64_t seq = 0; seq < NUM_MESSAGES; seq++) {
+        size_t size = record_size(seq);
+        unsigned char *buf = malloc(size);
+        if (NULL == buf) {
+            printf("Producer: can not allocate %zu bytes\n", size);
+            abort();
+        }
+
+        memcpy(buf, &seq, sizeof(seq));
+        for (size_t off = sizeof(seq); off < size; off++) buf[off] = record_byte(seq, off);
+
+        int rc = rb_spill_push(spill, buf, size);
+        if (RB_SPILLED == rc) {
+            /* The payload was copied, the caller still owns the buffer */
+            free(buf);
+        } else if (RB_OK != rc) {
+            printf("Producer: rb_spill_push() failed with %d at %lu\n", rc, seq);
+            abort();
+        }
+
+        if (0 == seq % PAUSE_EVERY) sched_yield();
+    }
+
+    /* The last batch stays invisible to the consumer until it is written */
+    if (RB_OK != rb_spill_flush(spill)) {
+        printf("Producer: rb_spill_flush() failed\n");
+        abort();
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer thread: reads NUM_MESSAGES records and validates them
+ * @param void* arg   Pointer to uint64_t, receives the number of spilled records read
+ * @return void* Ignored
+ */
+void *consumer(void *arg)
+{
+    uint64_t *spilled = arg;
+
+    set_my_cpu(1);
+
+    for (uint64_t seq = 0; seq < NUM_MESSAGES; seq++) {
+        void *data = NULL;
+        size_t size = 0;
+        int rc;
+
+        while (RB_EMPTY == (rc = rb_spill_pull(spill, &data, &size))) {
+            sched_yield();
+        }
+
+        if (RB_OK != rc && RB_SPILLED != rc) {
+            printf("Consumer: rb_spill_pull() failed with %d at %lu\n", rc, seq);
+            abort();
+        }
+
+        const unsigned char *buf = data;
+        uint64_t got;
+        memcpy(&got, buf, sizeof(got));
+
+        if (got != seq || size != record_size(seq)) {
+            printf("Expected record %lu of %zu bytes but it is %lu of %zu bytes (%s)\n", seq, record_size(seq),
+                   got, size, RB_SPILLED == rc ? "spilled" : "in memory");
+            abort();
+        }
+
+        for (size_t off = sizeof(got); off < size; off++) {
+            if (buf[off] != record_byte(seq, off)) {
+                printf("Record %lu (%s): wrong byte at offset %zu\n", seq, RB_SPILLED == rc ? "spilled" : "in memory",
+                       off);
+                abort();
+            }
+        }
+
+        if (RB_SPILLED == rc) {
+            if ((uintptr_t)data % _Alignof(max_align_t)) {
+                printf("Spilled record %lu is not aligned: %p\n", seq, data);
+                abort();
+            }
+            (*spilled)++;
+        } else {
+            /* The consumer owns the buffers from the in-memory ring */
+            free(data);
+        }
+    }
+
+    atomic_store_explicit(&done, 1, memory_order_release);
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Monitor thread: reads the statistics while the test runs and checks they never go back
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *monitor(__attribute__((unused))void *arg)
+{
+    rb_spill_stats_t prev = {0};
+
+    while (!atomic_load_explicit(&done, memory_order_acquire)) {
+        rb_spill_stats_t stats;
+
+        rb_spill_get_stats(spill, &stats);
+        if (stats.spilled_records < prev.spilled_records || stats.spilled_bytes < prev.spilled_bytes ||
+            stats.spill_entries < prev.spill_entries) {
+            printf("Monitor: the spill counters went back\n");
+            abort();
+        }
+        prev = stats;
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    pthread_t prod_thread, cons_thread, mon_thread;
+    uint64_t spilled = 0;
+    rb_spill_stats_t stats;
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    spill = rb_spill_alloc_init(TINY_CELLS, 64 * 1024 * 1024, SPILL_PATH, BATCH_SIZE);
+    if (NULL == spill) {
+        fprintf(stderr, "Failed to initialize the spilling ring.\n");
+        return EXIT_FAILURE;
+    }
+
+    uint64_t start_ns = get_time_ns();
+
+    pthread_create(&mon_thread, NULL, monitor, NULL);
+    pthread_create(&prod_thread, NULL, producer, NULL);
+    pthread_create(&cons_thread, NULL, consumer, &spilled);
+    pthread_join(prod_thread, NULL);
+    pthread_join(cons_thread, NULL);
+    pthread_join(mon_thread, NULL);
+
+    double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+    rb_spill_get_stats(spill, &stats);
+
+    printf("spill 16 cells: %.6f seconds, %'f messages/sec\n", elapsed_sec, NUM_MESSAGES / elapsed_sec);
+    printf("spill entries %'lu, spilled records %'lu (read %'lu), spilled bytes %'lu, spill time %.3f ms, order kept\n",
+           stats.spill_entries, stats.spilled_records, spilled, stats.spilled_bytes, stats.spill_ns / 1e6);
+
+    if (stats.spilled_records != spilled) {
+        printf("The consumer read %lu spilled records, the producer spilled %lu\n", spilled, stats.spilled_records);
+        return EXIT_FAILURE;
+    }
+
+    rb_spill_destroy(spill);
+    return EXIT_SUCCESS;
+}
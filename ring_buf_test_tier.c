@@ -0,0 +1,197 @@
+#define _GNU_SOURCE  // Enables GNU extensions like CPU_ZERO, CPU_SET
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <locale.h>
+#include <sched.h>
+
+#include "ring_buf.h"
+#include "ring_buf_tier.h"
+#include "ring_buf_test_common.h"
+
+/**
+ * Benchmark: two-tier ring (1K fast + 1M overflow) against a single 1M ring_buf_t.
+ * 1. Steady state: producer and consumer threads, the consumer keeps up with the producer.
+ * 2. Burst absorption: the producer pushes a burst while the consumer is not reading, then the consumer
+ *    drains it. A single 1K ring is measured too, to show how much of the burst it can not absorb.
+ * 3. Sustained overflow: a tiny fast ring and a producer which pushes bursts of PAUSE_EVERY records, larger
+ *    than the fast ring, and yields between them; the producer keeps switching between the tiers while the
+ *    consumer validates the order.
+ */
+
+#define NUM_MESSAGES 50000000
+#define FAST_CELLS (1024)
+#define SLOW_CELLS (1024 * 1024)
+#define BURST_SIZE (512 * 1024)
+#define BURST_ROUNDS 20
+#define TINY_CELLS 16
+#define PAUSE_EVERY 256
+
+typedef int (*push_fn_t)(void *ring, int64_t idata);
+typedef int (*pull_fn_t)(void *ring, int64_t *idata);
+
+/* The ring under test, shared between threads */
+void *ring = NULL;
+push_fn_t push_fn = NULL;
+pull_fn_t pull_fn = NULL;
+/* The producer yields every that many records; 0: never */
+int64_t pause_every = 0;
+
+static int push_single(void *r, int64_t idata) { return rb_push_int(r, idata); }
+static int pull_single(void *r, int64_t *idata) { return rb_pull_int(r, idata); }
+static int push_tier(void *r, int64_t idata) { return rb_tier_push_int(r, idata); }
+static int pull_tier(void *r, int64_t *idata) { return rb_tier_pull_int(r, idata); }
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer thread: writes NUM_MESSAGES integers, yields when the ring is full
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *producer(__attribute__((unused))void *arg)
+{
+    set_my_cpu(0);
+
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        while (RB_OK != push_fn(ring, i)) {
+            sched_yield();
+        }
+
+        if (pause_every && 0 == i % pause_every) sched_yield();
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer thread: reads NUM_MESSAGES integers and validates the order
+ * @param void* arg   Ignored
+ * @return void* Ignored
+ */
+void *consumer(__attribute__((unused))void *arg)
+{
+    set_my_cpu(1);
+
+    for (int64_t i = 0; i < NUM_MESSAGES; i++) {
+        int64_t idata;
+
+        while (RB_OK != pull_fn(ring, &idata)) {
+            sched_yield();
+        }
+
+        if (idata != i) {
+            printf("Expected payload %ld but it is %ld\n", i, idata);
+            abort();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Run the steady state test on the given ring
+ * @param const char* name  Name to print
+ */
+void run_steady(const char *name)
+{
+    pthread_t prod_thread, cons_thread;
+    uint64_t start_ns = get_time_ns();
+
+    pthread_create(&prod_thread, NULL, producer, NULL);
+    pthread_create(&cons_thread, NULL, consumer, NULL);
+    pthread_join(prod_thread, NULL);
+    pthread_join(cons_thread, NULL);
+
+    double elapsed_sec = (get_time_ns() - start_ns) / 1e9;
+    printf("%-24s steady: %.6f seconds, %'f messages/sec\n", name, elapsed_sec, NUM_MESSAGES / elapsed_sec);
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Run the burst test on the given ring: push BURST_SIZE records, then drain them
+ * @param const char* name  Name to print
+ */
+void run_burst(const char *name)
+{
+    uint64_t push_ns = 0, pull_ns = 0, rejected = 0, absorbed = 0;
+
+    for (int round = 0; round < BURST_ROUNDS; round++) {
+        uint64_t start_ns = get_time_ns();
+        int64_t pushed = 0;
+
+        for (int64_t i = 0; i < BURST_SIZE; i++) {
+            if (RB_OK == push_fn(ring, i)) {
+                pushed++;
+            } else {
+                rejected++;
+            }
+        }
+
+        uint64_t mid_ns = get_time_ns();
+
+        for (int64_t i = 0; i < pushed; i++) {
+            int64_t idata;
+            if (RB_OK != pull_fn(ring, &idata) || idata != i) {
+                printf("Burst: expected payload %ld\n", i);
+                abort();
+            }
+        }
+
+        pull_ns += get_time_ns() - mid_ns;
+        push_ns += mid_ns - start_ns;
+        absorbed += pushed;
+    }
+
+    printf("%-24s burst: absorbed %'lu, rejected %'lu, push %.3f ns/msg, drain %.3f ns/msg\n",
+           name, absorbed, rejected, (double)push_ns / absorbed, (double)pull_ns / absorbed);
+}
+
+int main(void)
+{
+    ring_buf_t *single_small;
+    ring_buf_t *single_large;
+    rb_tier_t *tier;
+    rb_tier_t *tiny;
+
+    /* Just for nice printing */
+    setlocale(LC_ALL, "");
+
+    single_small = rb_alloc_init(FAST_CELLS, 64 * 1024 * 1024);
+    single_large = rb_alloc_init(SLOW_CELLS, 64 * 1024 * 1024);
+    tier = rb_tier_alloc_init(FAST_CELLS, SLOW_CELLS, 64 * 1024 * 1024);
+    tiny = rb_tier_alloc_init(TINY_CELLS, FAST_CELLS, 64 * 1024 * 1024);
+
+    if (NULL == single_small || NULL == single_large || NULL == tier || NULL == tiny) {
+        fprintf(stderr, "Failed to initialize the rings.\n");
+        return EXIT_FAILURE;
+    }
+
+    ring = single_large; push_fn = push_single; pull_fn = pull_single;
+    run_steady("single ring 1M");
+    ring = tier; push_fn = push_tier; pull_fn = pull_tier;
+    run_steady("two-tier 1K + 1M");
+
+    ring = single_small; push_fn = push_single; pull_fn = pull_single;
+    run_burst("single ring 1K");
+    ring = single_large;
+    run_burst("single ring 1M");
+    ring = tier; push_fn = push_tier; pull_fn = pull_tier;
+    run_burst("two-tier 1K + 1M");
+    printf("two-tier diversions: %'lu, overflowed records: %'lu\n", tier->diversions, tier->overflowed);
+
+    ring = tiny;
+    pause_every = PAUSE_EVERY;
+    run_steady("two-tier 16 + 1K");
+    printf("two-tier overflow: diversions %'lu, overflowed records %'lu, order kept\n", tiny->diversions,
+           tiny->overflowed);
+
+    rb_destroy(single_small);
+    rb_destroy(single_large);
+    rb_tier_destroy(tier);
+    rb_tier_destroy(tiny);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,181 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a two-tier Ring Buffer: a small fast ring with a large overflow ring.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_tier.h"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: return to the fast ring when the consumer acknowledged the drained overflow ring
+ * @param rb_tier_t* t     Two-tier Ring Buffer
+ * @details The acknowledgement alone is not enough: the producer could divert more records after the consumer
+ *          found the overflow ring empty, so it is checked empty again here.
+ */
+static inline void rb_tier_check_slow(rb_tier_t *t)
+{
+    uint64_t epoch = atomic_load_explicit(&t->epoch, memory_order_relaxed);
+
+    if (!(epoch & 1)) return;
+    if (atomic_load_explicit(&t->ack, memory_order_acquire) != epoch) return;
+
+    uint64_t tail = atomic_load_explicit(&t->slow->tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&t->slow->head, memory_order_acquire);
+
+    if (head == tail) {
+        atomic_store_explicit(&t->epoch, epoch + 1, memory_order_release);
+    }
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Producer side: the fast ring is full, start diverting
+ * @param rb_tier_t* t     Two-tier Ring Buffer
+ * @details The new epoch is published before the first record of the overflow ring
+ */
+static inline void rb_tier_divert(rb_tier_t *t)
+{
+    uint64_t epoch = atomic_load_explicit(&t->epoch, memory_order_relaxed);
+
+    atomic_store_explicit(&t->epoch, epoch + 1, memory_order_release);
+    t->diversions++;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Consumer side: the fast ring is empty, may the overflow ring be read?
+ * @param rb_tier_t* t     Two-tier Ring Buffer
+ * @param uint64_t epoch Epoch read before the fast ring was found empty
+ * @return int 1 if the next record of the overflow ring may be pulled, 0 if there is nothing to read, -1 if
+ *         the producer switched tiers meanwhile and the fast ring must be read again
+ */
+static inline int rb_tier_slow_ready(rb_tier_t *t, uint64_t epoch)
+{
+    cell_t *cells;
+
+    /* The producer does not divert: the overflow ring can only hold records of a later diversion */
+    if (!(epoch & 1)) return 0;
+
+    if (0 == rb_peek_span(t->slow, &cells)) {
+        /* Both rings are empty in this diversion: let the producer return to the fast ring */
+        if (atomic_load_explicit(&t->ack, memory_order_relaxed) != epoch) {
+            atomic_store_explicit(&t->ack, epoch, memory_order_release);
+        }
+        return 0;
+    }
+
+    /* The producer publishes a new epoch before pushing a record of a new diversion */
+    if (atomic_load_explicit(&t->epoch, memory_order_acquire) != epoch) return -1;
+
+    return 1;
+}
+
+rb_tier_t *rb_tier_alloc_init(size_t fast_cells, size_t slow_cells, size_t max_alloc_size)
+{
+    rb_tier_t *t = aligned_alloc(64, sizeof(rb_tier_t));
+    if (NULL == t) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(t, 0, sizeof(rb_tier_t));
+
+    t->fast = rb_alloc_init(fast_cells, max_alloc_size);
+    if (NULL == t->fast) {
+        free(t);
+        return NULL;
+    }
+
+    t->slow = rb_alloc_init(slow_cells, max_alloc_size);
+    if (NULL == t->slow) {
+        rb_destroy(t->fast);
+        free(t);
+        return NULL;
+    }
+
+    return t;
+}
+
+void rb_tier_destroy(rb_tier_t *t)
+{
+    if (!t) return;
+
+    rb_destroy(t->fast);
+    rb_destroy(t->slow);
+    free(t);
+}
+
+int rb_tier_push_ptr(rb_tier_t *t, void *data, size_t size)
+{
+    if (!t) return RB_PARAM_ERROR;
+
+    rb_tier_check_slow(t);
+
+    if (!(atomic_load_explicit(&t->epoch, memory_order_relaxed) & 1)) {
+        int rc = rb_push_ptr(t->fast, data, size);
+        if (RB_FULL != rc) return rc;
+
+        rb_tier_divert(t);
+    }
+
+    int rc = rb_push_ptr(t->slow, data, size);
+    if (RB_OK == rc) t->overflowed++;
+    return rc;
+}
+
+int rb_tier_pull_ptr(rb_tier_t *t, void **data, size_t *size)
+{
+    if (!t) return RB_PARAM_ERROR;
+
+    for (;;) {
+        uint64_t epoch = atomic_load_explicit(&t->epoch, memory_order_acquire);
+        int rc = rb_pull_ptr(t->fast, data, size);
+        if (RB_EMPTY != rc) return rc;
+
+        int ready = rb_tier_slow_ready(t, epoch);
+        if (ready > 0) return rb_pull_ptr(t->slow, data, size);
+        if (0 == ready) return RB_EMPTY;
+    }
+}
+
+__attribute__((hot))
+int rb_tier_push_int(rb_tier_t *t, int64_t idata)
+{
+    if (!t) return RB_PARAM_ERROR;
+
+    rb_tier_check_slow(t);
+
+    if (!(atomic_load_explicit(&t->epoch, memory_order_relaxed) & 1)) {
+        int rc = rb_push_int(t->fast, idata);
+        if (RB_FULL != rc) return rc;
+
+        rb_tier_divert(t);
+    }
+
+    int rc = rb_push_int(t->slow, idata);
+    if (RB_OK == rc) t->overflowed++;
+    return rc;
+}
+
+__attribute__((hot))
+int rb_tier_pull_int(rb_tier_t *t, int64_t *idata)
+{
+    if (!t) return RB_PARAM_ERROR;
+
+    for (;;) {
+        uint64_t epoch = atomic_load_explicit(&t->epoch, memory_order_acquire);
+        int rc = rb_pull_int(t->fast, idata);
+        if (RB_EMPTY != rc) return rc;
+
+        int ready = rb_tier_slow_ready(t, epoch);
+        if (ready > 0) return rb_pull_int(t->slow, idata);
+        if (0 == ready) return RB_EMPTY;
+    }
+}
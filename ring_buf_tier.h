@@ -0,0 +1,91 @@
+#ifndef RING_BUF_TIER_H
+#define RING_BUF_TIER_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Two-tier Ring Buffer: a small cache-resident fast ring backed by a large overflow ring
+ * @details In normal operation all traffic goes through the small fast ring, so the working set stays in
+ *          L1/L2. When the fast ring is full, the producer diverts into the overflow ring and keeps diverting
+ *          until the consumer drained the overflow ring completely. The consumer always drains the fast ring
+ *          first and only then the overflow ring.
+ *          The switches are ordered by an epoch counter, written by the producer only: even while it pushes
+ *          into the fast ring, odd while it diverts. The switch back to the fast ring is a handshake: the
+ *          consumer acknowledges the odd epoch once it found both rings empty, and the producer returns only
+ *          after the acknowledgement, when the overflow ring is still empty. The consumer reads the epoch
+ *          before the fast ring, and takes a record from the overflow ring only if the epoch did not move
+ *          meanwhile; so a consumer which saw the fast ring empty in an earlier phase can not pull a record
+ *          of the next diversion before the fast ring records pushed in between. Every record in the fast ring
+ *          is then older than every record in the overflow ring it is read with, and FIFO order is kept.
+ */
+typedef struct {
+    ring_buf_t *fast;        /**< Small ring, used in normal operation */
+    ring_buf_t *slow;        /**< Large overflow ring, used during bursts */
+    uint64_t epoch __attribute__((aligned(64))); /**< Producer: odd while pushing into the overflow ring */
+    uint64_t diversions;     /**< Producer: how many times the producer switched to the overflow ring */
+    uint64_t overflowed;     /**< Producer: how many records went into the overflow ring */
+    uint64_t ack __attribute__((aligned(64))); /**< Consumer: last odd epoch whose overflow ring it drained */
+} rb_tier_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the two-tier Ring Buffer
+ * @param size_t fast_cells     Number of cells in the fast ring, must be power of 2
+ * @param size_t slow_cells     Number of cells in the overflow ring, must be power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate for each ring
+ * @return rb_tier_t* Allocated and inited structure; NULL on error
+ */
+rb_tier_t *rb_tier_alloc_init(size_t fast_cells, size_t slow_cells, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the two-tier Ring Buffer
+ * @param rb_tier_t* t     Pointer to the structure to free
+ */
+void rb_tier_destroy(rb_tier_t *t);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a pointer and the buffer size (producer side)
+ * @param rb_tier_t* t     Two-tier Ring Buffer
+ * @param void* data  Pointer to a buffer to save
+ * @param size_t size  Size of the saved buffer
+ * @return int RB_OK if saved, RB_FULL if both tiers are full, RB_PARAM_ERROR if the structure is NULL
+ */
+int rb_tier_push_ptr(rb_tier_t *t, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer (consumer side)
+ * @param rb_tier_t* t     Two-tier Ring Buffer
+ * @param void** data  Double pointer; must point to NULL, the pointer to a buffer will be copied into
+ * @param size_t* size  Must point to 0; size of returned buffer
+ * @return int RB_OK on success, RB_PARAM_ERROR if one of input pointers is invalid; RB_EMPTY if both tiers
+ *         are empty
+ */
+int rb_tier_pull_ptr(rb_tier_t *t, void **data, size_t *size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Push an integer value (producer side)
+ * @param rb_tier_t* t     Two-tier Ring Buffer
+ * @param int64_t idata Integer value to save
+ * @return int RB_OK if saved, RB_FULL if both tiers are full, RB_PARAM_ERROR if the structure is NULL
+ */
+__attribute__((hot))
+int rb_tier_push_int(rb_tier_t *t, int64_t idata);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Extract an integer value (consumer side)
+ * @param rb_tier_t* t     Two-tier Ring Buffer
+ * @param int64_t* idata Pointer to integer, the value will be copied into
+ * @return int RB_OK if a value extracted; RB_PARAM_ERROR if one of pointers is invalid; RB_EMPTY if both
+ *         tiers are empty
+ */
+__attribute__((hot))
+int rb_tier_pull_int(rb_tier_t *t, int64_t *idata);
+
+#endif // RING_BUF_TIER_H
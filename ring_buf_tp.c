@@ -0,0 +1,104 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements an SPSC pointer ring with 8-byte cells: the size is packed into the pointer upper bits.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_tp.h"
+
+rb_tp_t *rb_tp_alloc_init(size_t num_cells, size_t max_alloc_size)
+{
+    size_t total_memory;
+    rb_tp_t *r;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    total_memory = sizeof(rb_tp_t) + num_cells * sizeof(uint64_t);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    r = aligned_alloc(64, total_memory);
+    if (NULL == r) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(r, 0, total_memory);
+    r->capacity = num_cells;
+    r->max_alloc_size = max_alloc_size;
+
+    return r;
+}
+
+void rb_tp_destroy(rb_tp_t *r)
+{
+    free(r);
+}
+
+__attribute__((hot))
+int rb_tp_push_ptr(rb_tp_t *r, void *data, size_t size)
+{
+    if (!r || (uint64_t)size > RB_TP_PTR_MASK) return RB_PARAM_ERROR;
+
+    uint64_t ptr = (uint64_t)(uintptr_t)data;
+    int compact = size <= RB_TP_SIZE_MAX && 0 == (ptr & ~RB_TP_PTR_MASK);
+    uint64_t need = compact ? 1 : 2;
+    uint64_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+    if (tail + need - r->cached_head > r->capacity) {
+        r->cached_head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (tail + need - r->cached_head > r->capacity) return RB_FULL; // Buffer is full
+    }
+
+    uint64_t mask = r->capacity - 1;
+
+    if (compact) {
+        r->cells[tail & mask] = ((uint64_t)size << RB_TP_PTR_BITS) | ptr;
+    } else {
+        r->cells[tail & mask] = (RB_TP_ESCAPE << RB_TP_PTR_BITS) | (uint64_t)size;
+        r->cells[(tail + 1) & mask] = ptr;
+    }
+
+    atomic_store_explicit(&r->tail, tail + need, memory_order_release);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_tp_pull_ptr(rb_tp_t *r, void **data, size_t *size)
+{
+    if (!r || !data || !size) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+
+    if (head == r->cached_tail) {
+        r->cached_tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+        if (head == r->cached_tail) return RB_EMPTY; // Buffer is empty
+    }
+
+    uint64_t mask = r->capacity - 1;
+    uint64_t cell = r->cells[head & mask];
+    uint64_t tag = cell >> RB_TP_PTR_BITS;
+
+    if (RB_TP_ESCAPE == tag) {
+        /* The producer published both cells of the escape pair at once */
+        *size = cell & RB_TP_PTR_MASK;
+        *data = (void *)(uintptr_t)r->cells[(head + 1) & mask];
+        atomic_store_explicit(&r->head, head + 2, memory_order_release);
+        return RB_OK;
+    }
+
+    *size = tag;
+    *data = (void *)(uintptr_t)(cell & RB_TP_PTR_MASK);
+    atomic_store_explicit(&r->head, head + 1, memory_order_release);
+    return RB_OK;
+}
@@ -0,0 +1,72 @@
+#ifndef RING_BUF_TP_H
+#define RING_BUF_TP_H
+
+#include "ring_buf.h"
+
+/* User space pointers fit in the low 48 bits; the size is kept in the upper 16 bits */
+#define RB_TP_PTR_BITS 48
+#define RB_TP_PTR_MASK ((1ULL << RB_TP_PTR_BITS) - 1)
+/* Size tag meaning "escape": the cell holds the size, the next cell holds the raw pointer */
+#define RB_TP_ESCAPE 0xFFFFULL
+/* Largest size stored in the compact form */
+#define RB_TP_SIZE_MAX (RB_TP_ESCAPE - 1)
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Lock-free SPSC pointer ring with 8-byte tagged-pointer cells
+ * @details cell_t takes 16 bytes for a pointer and a size. Here the size is packed into the unused upper 16
+ *          bits of a 48-bit user space pointer, so one cell takes 8 bytes and a cache line holds 8 records
+ *          instead of 4. Records which do not fit (size >= RB_TP_ESCAPE, or a pointer with upper bits set)
+ *          take two cells: an escape cell with the size, then the raw pointer. Both are published together.
+ *          The control structure and the cells are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t capacity;       /**< Number of cells (power of 2) */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t tail __attribute__((aligned(64))); /**< Producer write index */
+    uint64_t cached_head;    /**< Producer: last seen consumer index */
+    uint64_t head __attribute__((aligned(64))); /**< Consumer read index */
+    uint64_t cached_tail;    /**< Consumer: last seen producer index */
+    uint64_t cells[] __attribute__((aligned(64))); /**< Tagged pointers */
+} rb_tp_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the tagged-pointer ring
+ * @param size_t num_cells     How many cells should be in the ring, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @return rb_tp_t* Allocated and inited ring; NULL on error
+ */
+rb_tp_t *rb_tp_alloc_init(size_t num_cells, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the tagged-pointer ring
+ * @param rb_tp_t* r     Ring to free
+ */
+void rb_tp_destroy(rb_tp_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a pointer and the buffer size in the ring (producer side)
+ * @param rb_tp_t* r     Ring
+ * @param void* data  Pointer to a buffer to save
+ * @param size_t size  Size of the saved buffer, less than 2^48
+ * @return int RB_OK if saved, RB_FULL if the ring is full, RB_PARAM_ERROR on invalid input
+ */
+__attribute__((hot))
+int rb_tp_push_ptr(rb_tp_t *r, void *data, size_t size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull next buffer from the ring (consumer side)
+ * @param rb_tp_t* r     Ring
+ * @param void** data  The pointer to a buffer will be copied into
+ * @param size_t* size  Size of returned buffer
+ * @return int RB_OK on success, RB_EMPTY if the ring is empty, RB_PARAM_ERROR on invalid input
+ */
+__attribute__((hot))
+int rb_tp_pull_ptr(rb_tp_t *r, void **data, size_t *size);
+
+#endif // RING_BUF_TP_H
@@ -0,0 +1,138 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements a pointer ring with per-record time to live; the consumer skips expired records.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_ttl.h"
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Find the first fresh record in [head, tail)
+ * @param rb_ttl_t* r     Ring
+ * @param uint64_t head  First index to check
+ * @param uint64_t tail  Index after the last record
+ * @param uint64_t now_ns Current time
+ * @return uint64_t Index of the first fresh record, tail if all records expired
+ * @details The enqueue times are monotonic, so a binary search is enough
+ */
+static inline uint64_t rb_ttl_first_fresh(rb_ttl_t *r, uint64_t head, uint64_t tail, uint64_t now_ns)
+{
+    uint64_t mask = r->capacity - 1;
+    uint64_t lo = head, hi = tail;
+
+    /* The common case: the oldest record is fresh */
+    if (now_ns - r->cells[head & mask].ts <= r->ttl_ns || now_ns < r->cells[head & mask].ts) return head;
+
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        uint64_t ts = r->cells[mid & mask].ts;
+
+        if (now_ns > ts && now_ns - ts > r->ttl_ns) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+rb_ttl_t *rb_ttl_alloc_init(size_t num_cells, size_t max_alloc_size, uint64_t ttl_ns,
+                            rb_ttl_drop_cb_t drop_cb, void *drop_ctx)
+{
+    size_t total_memory;
+    rb_ttl_t *r;
+
+    if (num_cells < 2 || (num_cells & (num_cells - 1)) != 0) {
+        printf("Number of cells must be power of 2\n");
+        return NULL;
+    }
+
+    total_memory = sizeof(rb_ttl_t) + num_cells * sizeof(rb_ttl_cell_t);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    r = aligned_alloc(64, total_memory);
+    if (NULL == r) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(r, 0, total_memory);
+    r->capacity = num_cells;
+    r->max_alloc_size = max_alloc_size;
+    r->ttl_ns = ttl_ns;
+    r->drop_cb = drop_cb;
+    r->drop_ctx = drop_ctx;
+
+    return r;
+}
+
+void rb_ttl_destroy(rb_ttl_t *r)
+{
+    free(r);
+}
+
+__attribute__((hot))
+int rb_ttl_push_ptr(rb_ttl_t *r, void *data, size_t size, uint64_t now_ns)
+{
+    if (!r) return RB_PARAM_ERROR;
+
+    uint64_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    uint64_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+
+    if (tail - head == r->capacity) return RB_FULL; // Buffer is full
+
+    rb_ttl_cell_t *cell = &r->cells[tail & (r->capacity - 1)];
+    cell->ts = now_ns;
+    cell->data = data;
+    cell->size = size;
+
+    atomic_store_explicit(&r->tail, tail + 1, memory_order_release);
+    return RB_OK;
+}
+
+__attribute__((hot))
+int rb_ttl_pull_ptr(rb_ttl_t *r, void **data, size_t *size, uint64_t now_ns, size_t *discarded)
+{
+    if (!r || !data || !size) return RB_PARAM_ERROR;
+
+    uint64_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+    uint64_t mask = r->capacity - 1;
+
+    if (discarded) *discarded = 0;
+    if (head == tail) return RB_EMPTY; // Buffer is empty
+
+    uint64_t fresh = rb_ttl_first_fresh(r, head, tail, now_ns);
+
+    if (fresh != head) {
+        if (r->drop_cb) {
+            for (uint64_t i = head; i < fresh; i++) {
+                r->drop_cb(r->cells[i & mask].data, r->cells[i & mask].size, r->drop_ctx);
+            }
+        }
+
+        r->discarded += fresh - head;
+        if (discarded) *discarded = fresh - head;
+    }
+
+    if (fresh == tail) {
+        atomic_store_explicit(&r->head, tail, memory_order_release);
+        return RB_EMPTY; // Everything expired
+    }
+
+    *data = r->cells[fresh & mask].data;
+    *size = r->cells[fresh & mask].size;
+
+    atomic_store_explicit(&r->head, fresh + 1, memory_order_release);
+    return RB_OK;
+}
@@ -0,0 +1,106 @@
+#ifndef RING_BUF_TTL_H
+#define RING_BUF_TTL_H
+
+#include "ring_buf.h"
+#include <time.h>         // Required for clock_gettime()
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Called by the consumer for every expired record it discards, e.g. to free the payload
+ * @param void* data  Pointer saved by the producer
+ * @param size_t size  Size saved by the producer
+ * @param void* ctx   Context given to rb_ttl_alloc_init()
+ */
+typedef void (*rb_ttl_drop_cb_t)(void *data, size_t size, void *ctx);
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief One record of the TTL ring: the payload and its enqueue time
+ */
+typedef struct {
+    uint64_t ts;             /**< Enqueue time, nanoseconds */
+    void *data;              /**< Pointer to the actual data */
+    uint64_t size;           /**< Size of the data */
+} __attribute__((aligned(32))) rb_ttl_cell_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Lock-free SPSC pointer ring which skips expired records
+ * @details Every record keeps its enqueue time. Since the times grow monotonically, the consumer finds the
+ *          first fresh record with a binary search and jumps the head index over all expired ones at once,
+ *          so after a stall the consumer latency stays bounded instead of processing stale records one by
+ *          one. The control structure and the cells are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t capacity;       /**< Number of cells (power of 2) */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t ttl_ns;         /**< Records older than this are discarded */
+    rb_ttl_drop_cb_t drop_cb;/**< Optional callback for discarded records */
+    void *drop_ctx;          /**< Context of drop_cb */
+    uint64_t tail __attribute__((aligned(64))); /**< Producer write index */
+    uint64_t head __attribute__((aligned(64))); /**< Consumer read index */
+    uint64_t discarded;      /**< Consumer: total number of discarded records */
+    rb_ttl_cell_t cells[] __attribute__((aligned(64))); /**< Ring data */
+} rb_ttl_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Get current CLOCK_MONOTONIC time in nanoseconds, the default time source for the TTL ring
+ * @return uint64_t Current time
+ */
+static inline uint64_t rb_ttl_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the TTL ring
+ * @param size_t num_cells     How many records should be in the ring, power of 2
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @param uint64_t ttl_ns      Time to live of a record, nanoseconds
+ * @param rb_ttl_drop_cb_t drop_cb Called for every discarded record; may be NULL
+ * @param void* drop_ctx  Context of drop_cb
+ * @return rb_ttl_t* Allocated and inited ring; NULL on error
+ */
+rb_ttl_t *rb_ttl_alloc_init(size_t num_cells, size_t max_alloc_size, uint64_t ttl_ns,
+                            rb_ttl_drop_cb_t drop_cb, void *drop_ctx);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the TTL ring
+ * @param rb_ttl_t* r     Ring to free
+ */
+void rb_ttl_destroy(rb_ttl_t *r);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Save a pointer, the buffer size and the enqueue time (producer side)
+ * @param rb_ttl_t* r     Ring
+ * @param void* data  Pointer to a buffer to save
+ * @param size_t size  Size of the saved buffer
+ * @param uint64_t now_ns Enqueue time, e.g. rb_ttl_now_ns(); must not go backward
+ * @return int RB_OK if saved, RB_FULL if the ring is full, RB_PARAM_ERROR if the ring is NULL
+ */
+__attribute__((hot))
+int rb_ttl_push_ptr(rb_ttl_t *r, void *data, size_t size, uint64_t now_ns);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Pull the next fresh buffer, discarding all expired ones in one pass (consumer side)
+ * @param rb_ttl_t* r     Ring
+ * @param void** data  The pointer to a buffer will be copied into
+ * @param size_t* size  Size of returned buffer
+ * @param uint64_t now_ns Current time, same time source as the producer
+ * @param size_t* discarded Optional output: number of expired records discarded by this call
+ * @return int RB_OK if a fresh buffer is returned, RB_EMPTY if there is no fresh record (expired ones may
+ *         have been discarded), RB_PARAM_ERROR on invalid input
+ */
+__attribute__((hot))
+int rb_ttl_pull_ptr(rb_ttl_t *r, void **data, size_t *size, uint64_t now_ns, size_t *discarded);
+
+#endif // RING_BUF_TTL_H
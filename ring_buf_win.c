@@ -0,0 +1,135 @@
+#ifdef _POSIX_C_SOURCE
+#undef _POSIX_C_SOURCE
+#endif
+
+/**
+ * This file implements incremental sliding window aggregations: running sum and monotonic deques.
+ */
+
+#define _POSIX_C_SOURCE 200112L  // Enables POSIX API, including posix_memalign
+
+#include <string.h>
+#include <stdlib.h>
+#include "ring_buf_win.h"
+
+rb_win_t *rb_win_alloc_init(size_t window, size_t max_alloc_size)
+{
+    size_t capacity = 1;
+    size_t total_memory;
+    rb_win_t *w;
+
+    if (0 == window || window > ((size_t)1 << 40)) return NULL;
+
+    while (capacity < window) capacity <<= 1;
+
+    total_memory = sizeof(rb_win_t) + capacity * sizeof(int64_t) + 2 * capacity * sizeof(rb_win_entry_t);
+    if (total_memory > max_alloc_size) {
+        return NULL;
+    }
+
+    w = aligned_alloc(64, (total_memory + 63) & ~(size_t)63);
+    if (NULL == w) {
+        perror("Can not allocate aligned memory: ");
+        return NULL;
+    }
+
+    memset(w, 0, sizeof(rb_win_t));
+    w->window = window;
+    w->capacity = capacity;
+    w->max_alloc_size = max_alloc_size;
+    w->history = (int64_t *)(w + 1);
+    w->min_q = (rb_win_entry_t *)(w->history + capacity);
+    w->max_q = w->min_q + capacity;
+
+    return w;
+}
+
+void rb_win_destroy(rb_win_t *w)
+{
+    free(w);
+}
+
+void rb_win_reset(rb_win_t *w)
+{
+    w->seen = 0;
+    w->sum = 0;
+    w->min_head = w->min_tail = 0;
+    w->max_head = w->max_tail = 0;
+}
+
+__attribute__((hot))
+void rb_win_add(rb_win_t *w, int64_t x)
+{
+    uint64_t mask = w->capacity - 1;
+    uint64_t seq = w->seen++;
+
+    /* Running sum: the value leaving the window goes out, the new one comes in */
+    if (seq >= w->window) w->sum -= (uint64_t)w->history[(seq - w->window) & mask];
+    w->history[seq & mask] = x;
+    w->sum += (uint64_t)x;
+
+    /* The front leaves the window first, so a deque never holds more than N entries */
+    if (w->min_tail != w->min_head && w->min_q[w->min_head & mask].seq + w->window <= seq) w->min_head++;
+    if (w->max_tail != w->max_head && w->max_q[w->max_head & mask].seq + w->window <= seq) w->max_head++;
+
+    /* Min deque: values not smaller than x can never be the minimum again */
+    while (w->min_tail != w->min_head && w->min_q[(w->min_tail - 1) & mask].value >= x) w->min_tail--;
+    w->min_q[w->min_tail++ & mask] = (rb_win_entry_t){ .seq = seq, .value = x };
+
+    /* Max deque: values not larger than x can never be the maximum again */
+    while (w->max_tail != w->max_head && w->max_q[(w->max_tail - 1) & mask].value <= x) w->max_tail--;
+    w->max_q[w->max_tail++ & mask] = (rb_win_entry_t){ .seq = seq, .value = x };
+}
+
+int rb_win_get(rb_win_t *w, rb_win_stats_t *st)
+{
+    if (!w || !st) return RB_PARAM_ERROR;
+    if (0 == w->seen) return RB_EMPTY;
+
+    uint64_t mask = w->capacity - 1;
+
+    st->count = w->seen < w->window ? w->seen : w->window;
+    st->sum = (int64_t)w->sum;
+    st->min = w->min_q[w->min_head & mask].value;
+    st->max = w->max_q[w->max_head & mask].value;
+    st->mean = (double)st->sum / st->count;
+
+    return RB_OK;
+}
+
+int rb_win_pull_int(ring_buf_t *d, rb_win_t *w, int64_t *idata)
+{
+    if (!w) return RB_PARAM_ERROR;
+
+    int rc = rb_pull_int(d, idata);
+    if (RB_OK == rc) rb_win_add(w, *idata);
+
+    return rc;
+}
+
+size_t rb_win_drain(ring_buf_t *d, rb_win_t *w, size_t max)
+{
+    size_t total = 0;
+
+    if (!d || !w) return 0;
+
+    /* Not more than one ring worth, so a fast producer can not keep the call running forever */
+    if (0 == max || max > d->capacity) max = d->capacity;
+
+    while (total < max) {
+        cell_t *cells;
+        size_t n = rb_peek_span(d, &cells);
+
+        if (n > max - total) n = max - total;
+        if (0 == n) break;
+
+        for (size_t i = 0; i < n; i++) {
+            rb_win_add(w, cells[i].idata);
+        }
+
+        rb_release_span(d, n);
+        total += n;
+    }
+
+    return total;
+}
@@ -0,0 +1,115 @@
+#ifndef RING_BUF_WIN_H
+#define RING_BUF_WIN_H
+
+#include "ring_buf.h"
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Entry of a monotonic deque: a value and its position in the stream
+ */
+typedef struct {
+    uint64_t seq;            /**< Position of the value in the stream */
+    int64_t value;           /**< The value */
+} rb_win_entry_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Aggregates of the current window, see rb_win_get()
+ */
+typedef struct {
+    uint64_t count;          /**< Values in the window: the window size, or less at the start of the stream */
+    int64_t sum;             /**< Sum of the values; wraps around on overflow */
+    int64_t min;             /**< Minimal value */
+    int64_t max;             /**< Maximal value */
+    double mean;             /**< sum / count */
+} rb_win_stats_t;
+
+/**
+ * @struct
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Sliding window aggregator over the last N values of an integer stream
+ * @details Every new value updates the aggregates in O(1) amortized time: the running sum adds the new value and
+ *          subtracts the one leaving the window (kept in a history ring of the last N values); min and max are
+ *          the fronts of two monotonic deques, from which values are dropped when a better one arrives or when
+ *          they leave the window. Nothing is rescanned. Used by one thread, usually the consumer of the ring.
+ *          The control structure, the history and both deques are allocated as a single memory block.
+ */
+typedef struct {
+    uint64_t window;         /**< Window size N */
+    uint64_t capacity;       /**< Size of the history and of the deques: N rounded up to a power of 2 */
+    uint64_t max_alloc_size; /**< Max allowed allocation size */
+    uint64_t seen;           /**< Values added since the start */
+    uint64_t sum;            /**< Running sum of the window */
+    uint64_t min_head;       /**< Min deque: front */
+    uint64_t min_tail;       /**< Min deque: back */
+    uint64_t max_head;       /**< Max deque: front */
+    uint64_t max_tail;       /**< Max deque: back */
+    int64_t *history;        /**< The last N values */
+    rb_win_entry_t *min_q;   /**< Increasing values: the front is the minimum */
+    rb_win_entry_t *max_q;   /**< Decreasing values: the front is the maximum */
+} rb_win_t;
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Allocate and init the window aggregator
+ * @param size_t window  Window size N, > 0
+ * @param size_t max_alloc_size Maximum allowed memory to allocate
+ * @return rb_win_t* Allocated aggregator; NULL on error
+ */
+rb_win_t *rb_win_alloc_init(size_t window, size_t max_alloc_size);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Release the window aggregator
+ * @param rb_win_t* w     Aggregator
+ */
+void rb_win_destroy(rb_win_t *w);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Forget all values
+ * @param rb_win_t* w     Aggregator
+ */
+void rb_win_reset(rb_win_t *w);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Add the next value of the stream, O(1) amortized
+ * @param rb_win_t* w     Aggregator
+ * @param int64_t x     Value
+ */
+__attribute__((hot))
+void rb_win_add(rb_win_t *w, int64_t x);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Read the aggregates of the current window, O(1)
+ * @param rb_win_t* w     Aggregator
+ * @param rb_win_stats_t* st    Output
+ * @return int RB_OK on success, RB_EMPTY if no value was added yet, RB_PARAM_ERROR on invalid input
+ */
+int rb_win_get(rb_win_t *w, rb_win_stats_t *st);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Extract an integer value from the Ring Buffer and add it to the window (consumer side)
+ * @param ring_buf_t* d     Integer Ring Buffer
+ * @param rb_win_t* w     Aggregator
+ * @param int64_t* idata Output: the value
+ * @return int Same as rb_pull_int()
+ */
+int rb_win_pull_int(ring_buf_t *d, rb_win_t *w, int64_t *idata);
+
+/**
+ * @author Sebastian Mountaniol (17/10/2026)
+ * @brief Add up to max values of the Ring Buffer to the window, publishing head once per span (consumer side)
+ * @param ring_buf_t* d     Integer Ring Buffer
+ * @param rb_win_t* w     Aggregator
+ * @param size_t max   Maximal number of values; 0: everything readable now
+ * @return size_t Number of values taken from the ring
+ */
+size_t rb_win_drain(ring_buf_t *d, rb_win_t *w, size_t max);
+
+#endif // RING_BUF_WIN_H